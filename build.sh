@@ -8,12 +8,24 @@ YELLOW='\033[1;33m'
 CYAN='\033[0;36m'
 NC='\033[0m'
 
+# Build mode: "release" (default), "pgo" (profile-guided, see the PGO stage below),
+# "ct" (release plus the constant-time timing check, see the CT stage below)
+# or "check" (release plus the built-in dialect check, see the check stage below)
+BUILD_MODE="${1:-release}"
+case "$BUILD_MODE" in
+    release|pgo|ct|check) ;;
+    *)
+        echo "Usage: $0 [release|pgo|ct|check]"
+        exit 1
+        ;;
+esac
+
 echo -e "${GREEN}========================================${NC}"
 echo -e "${GREEN}  Skibidi AVX Native Library Builder   ${NC}"
 echo -e "${GREEN}  Version: 1.7.1                       ${NC}"
 echo -e "${GREEN}========================================${NC}"
 
-echo -e "\n${YELLOW}[1/5] Checking build environment...${NC}"
+echo -e "\n${YELLOW}[1/6] Checking build environment...${NC}"
 
 if ! command -v gcc &> /dev/null; then
     echo -e "${RED}Error: GCC not found.${NC}"
@@ -21,7 +33,7 @@ if ! command -v gcc &> /dev/null; then
     exit 1
 fi
 
-echo -e "\n${YELLOW}[2/5] Detecting CPU capabilities...${NC}"
+echo -e "\n${YELLOW}[2/6] Detecting CPU capabilities...${NC}"
 
 CPU_FLAGS=$(cat /proc/cpuinfo | grep flags | head -n 1)
 
@@ -40,13 +52,13 @@ else
     echo -e "  [-] ${YELLOW}AVX-512${NC} not detected (Using AVX2 or Scalar fallback)"
 fi
 
-echo -e "\n${YELLOW}[3/5] Creating output directories...${NC}"
+echo -e "\n${YELLOW}[3/6] Creating output directories...${NC}"
 mkdir -p build/linux-x86_64
-rm -f build/linux-x86_64/libskibidi_avx.so
+rm -f build/linux-x86_64/libskibidi_avx.so build/linux-x86_64/libskibidi_avx.a
 
-echo -e "\n${YELLOW}[4/5] Compiling for Linux x86_64...${NC}"
+echo -e "\n${YELLOW}[4/6] Compiling for Linux x86_64...${NC}"
 
-GCC_FLAGS="-O3 -fPIC -shared -flto -march=native -std=gnu11"
+GCC_FLAGS="-O3 -fPIC -shared -flto=auto -march=native -std=gnu11"
 WARN_FLAGS="-Wall -Wextra -Wno-unused-parameter"
 LINK_FLAGS="-Wl,-O1 -Wl,--as-needed -Wl,--no-undefined -pthread"
 
@@ -63,7 +75,152 @@ else
     exit 1
 fi
 
-echo -e "\n${YELLOW}[5/5] Verifying build artifacts...${NC}"
+echo -e "\n${YELLOW}[5/6] Building static archive with LTO bitcode...${NC}"
+
+# Fat LTO objects: -flto consumers inline across the library boundary,
+# everyone else links the regular machine code in the same archive.
+STATIC_FLAGS="-O3 -fPIC -flto -ffat-lto-objects -march=native -std=gnu11"
+
+echo "Command: gcc $STATIC_FLAGS -c ... && gcc-ar rcs ..."
+
+gcc $STATIC_FLAGS $WARN_FLAGS -c \
+    -o build/linux-x86_64/skibidi_avx.o \
+    ./skibidi_avx.c
+gcc-ar rcs build/linux-x86_64/libskibidi_avx.a build/linux-x86_64/skibidi_avx.o
+rm -f build/linux-x86_64/skibidi_avx.o
+
+echo -e "${GREEN}Build successful: build/linux-x86_64/libskibidi_avx.a${NC}"
+
+if [ "$BUILD_MODE" = "pgo" ]; then
+    # Profile-guided rebuild of the shared library. The plain build above is
+    # kept as the baseline and only replaced when the rebuild measures faster;
+    # skibidi_train.c is the representative workload.
+    # SKIBIDI_TRAIN_ROUNDS sizes the training run, SKIBIDI_BENCH_ROUNDS the
+    # comparison, SKIBIDI_BOLT=1 adds a BOLT layout pass when llvm-bolt exists.
+    PGO_DIR="$(pwd)/build/pgo"
+    TRAIN_ROUNDS="${SKIBIDI_TRAIN_ROUNDS:-2000}"
+    BENCH_ROUNDS="${SKIBIDI_BENCH_ROUNDS:-4000}"
+    PGO_CFLAGS="-O3 -fPIC -flto=auto -march=native -std=gnu11"
+    PGO_OBJ="$PGO_DIR/skibidi_avx.o"
+
+    rm -rf "$PGO_DIR"
+    mkdir -p "$PGO_DIR/plain" "$PGO_DIR/instrumented" "$PGO_DIR/profile" "$PGO_DIR/optimized"
+    cp build/linux-x86_64/libskibidi_avx.so "$PGO_DIR/plain/"
+
+    echo -e "\n${YELLOW}[PGO 1/4] Instrumented build...${NC}"
+    gcc $PGO_CFLAGS $WARN_FLAGS -fprofile-generate="$PGO_DIR/profile" -c -o "$PGO_OBJ" ./skibidi_avx.c
+    gcc $PGO_CFLAGS -shared -fprofile-generate="$PGO_DIR/profile" $LINK_FLAGS \
+        -o "$PGO_DIR/instrumented/libskibidi_avx.so" "$PGO_OBJ"
+
+    gcc -O2 -std=gnu11 $WARN_FLAGS -I. -o "$PGO_DIR/skibidi_train" ./skibidi_train.c \
+        -L"$PGO_DIR/instrumented" -lskibidi_avx -pthread
+
+    echo -e "\n${YELLOW}[PGO 2/4] Training ($TRAIN_ROUNDS rounds)...${NC}"
+    LD_LIBRARY_PATH="$PGO_DIR/instrumented" "$PGO_DIR/skibidi_train" "$TRAIN_ROUNDS" > /dev/null
+
+    echo -e "\n${YELLOW}[PGO 3/4] Profile-guided rebuild...${NC}"
+    PGO_LINK_FLAGS="$LINK_FLAGS"
+    if [ "${SKIBIDI_BOLT:-0}" = "1" ]; then
+        PGO_LINK_FLAGS="$PGO_LINK_FLAGS -Wl,--emit-relocs"
+    fi
+    gcc $PGO_CFLAGS $WARN_FLAGS -fprofile-use="$PGO_DIR/profile" -fprofile-correction \
+        -c -o "$PGO_OBJ" ./skibidi_avx.c
+    gcc $PGO_CFLAGS -shared $PGO_LINK_FLAGS -o "$PGO_DIR/optimized/libskibidi_avx.so" "$PGO_OBJ"
+
+    if [ "${SKIBIDI_BOLT:-0}" = "1" ]; then
+        if command -v llvm-bolt &> /dev/null; then
+            echo "  [+] BOLT: instrumenting, retraining and relaying out hot blocks"
+            mkdir -p "$PGO_DIR/bolt"
+            llvm-bolt "$PGO_DIR/optimized/libskibidi_avx.so" -instrument \
+                -instrumentation-file="$PGO_DIR/bolt.fdata" \
+                -o "$PGO_DIR/bolt/libskibidi_avx.so"
+            LD_LIBRARY_PATH="$PGO_DIR/bolt" "$PGO_DIR/skibidi_train" "$TRAIN_ROUNDS" > /dev/null
+            llvm-bolt "$PGO_DIR/optimized/libskibidi_avx.so" -data="$PGO_DIR/bolt.fdata" \
+                -reorder-blocks=ext-tsp -reorder-functions=hfsort -split-functions \
+                -o "$PGO_DIR/libskibidi_avx.bolt.so"
+            mv "$PGO_DIR/libskibidi_avx.bolt.so" "$PGO_DIR/optimized/libskibidi_avx.so"
+        else
+            echo -e "  [-] ${YELLOW}llvm-bolt${NC} not found, skipping BOLT"
+        fi
+    fi
+
+    echo -e "\n${YELLOW}[PGO 4/4] Measuring gain over the plain build ($BENCH_ROUNDS rounds)...${NC}"
+    PLAIN_NS=$(LD_LIBRARY_PATH="$PGO_DIR/plain" "$PGO_DIR/skibidi_train" "$BENCH_ROUNDS" 2> /dev/null | tee "$PGO_DIR/plain.txt" | awk '/^total/ { print $2 }')
+    PGO_NS=$(LD_LIBRARY_PATH="$PGO_DIR/optimized" "$PGO_DIR/skibidi_train" "$BENCH_ROUNDS" 2> /dev/null | tee "$PGO_DIR/pgo.txt" | awk '/^total/ { print $2 }')
+    paste "$PGO_DIR/plain.txt" "$PGO_DIR/pgo.txt" | \
+        awk '{ printf "  %-8s plain %8.3f  pgo %8.3f ns/line  (%+.1f%%)\n", $1, $2, $5, ($2 - $5) / $2 * 100 }'
+    PGO_GAIN=$(awk -v p="$PLAIN_NS" -v o="$PGO_NS" 'BEGIN { printf "%+.1f%%", (p - o) / p * 100 }')
+    if awk -v p="$PLAIN_NS" -v o="$PGO_NS" 'BEGIN { exit !(o > 0 && o < p) }'; then
+        cp "$PGO_DIR/optimized/libskibidi_avx.so" build/linux-x86_64/libskibidi_avx.so
+        echo -e "${GREEN}PGO gain: $PGO_GAIN (total ns/line $PLAIN_NS -> $PGO_NS), installed${NC}"
+    else
+        echo -e "${YELLOW}PGO gain: $PGO_GAIN (total ns/line $PLAIN_NS -> $PGO_NS), keeping the plain build${NC}"
+        echo "  The profile-guided library stays in $PGO_DIR/optimized/"
+    fi
+fi
+
+if [ "$BUILD_MODE" = "ct" ]; then
+    # dudect-style check of the constant-time kernels against the library just
+    # built: fixed seed versus random seeds, Welch's t-test on the cycle counts.
+    # SKIBIDI_DUDECT_MEASUREMENTS sets the measurements per workload.
+    CT_DIR="$(pwd)/build/ct"
+    DUDECT_MEASUREMENTS="${SKIBIDI_DUDECT_MEASUREMENTS:-1000000}"
+
+    rm -rf "$CT_DIR"
+    mkdir -p "$CT_DIR"
+
+    echo -e "\n${YELLOW}[CT 1/2] Building the timing harness...${NC}"
+    gcc -O2 -std=gnu11 -march=native $WARN_FLAGS -I. -o "$CT_DIR/skibidi_dudect" ./skibidi_dudect.c \
+        -Lbuild/linux-x86_64 -lskibidi_avx -lm -pthread
+
+    echo -e "\n${YELLOW}[CT 2/2] Fixed versus random seeds ($DUDECT_MEASUREMENTS measurements per workload)...${NC}"
+    CT_STATUS=0
+    LD_LIBRARY_PATH="build/linux-x86_64" "$CT_DIR/skibidi_dudect" "$DUDECT_MEASUREMENTS" \
+        > "$CT_DIR/dudect.txt" 2> "$CT_DIR/dudect.log" || CT_STATUS=$?
+    sed 's/^/  /' "$CT_DIR/dudect.txt"
+    if [ "$CT_STATUS" -eq 0 ]; then
+        echo -e "${GREEN}Constant-time check passed${NC}"
+    elif grep -q '^verdict' "$CT_DIR/dudect.txt"; then
+        echo -e "${RED}Constant-time check failed: timing depends on the seed${NC}"
+        exit 1
+    else
+        sed 's/^/  /' "$CT_DIR/dudect.log"
+        echo -e "${RED}Constant-time check could not run${NC}"
+        exit 1
+    fi
+fi
+
+if [ "$BUILD_MODE" = "check" ]; then
+    # The built-in phrase compiled as a grammar must match the built-in entry
+    # points line for line. Checked against the library just built, then
+    # compiled for baseline x86-64 so the SSE2 factories get their turn.
+    CHECK_DIR="$(pwd)/build/check"
+
+    rm -rf "$CHECK_DIR"
+    mkdir -p "$CHECK_DIR"
+
+    echo -e "\n${YELLOW}[CHECK 1/2] Built-in dialect against the library...${NC}"
+    gcc -O2 -std=gnu11 -march=native $WARN_FLAGS -I. -o "$CHECK_DIR/skibidi_check" ./skibidi_check.c \
+        -Lbuild/linux-x86_64 -lskibidi_avx -lm -pthread
+    CHECK_STATUS=0
+    LD_LIBRARY_PATH="build/linux-x86_64" "$CHECK_DIR/skibidi_check" > "$CHECK_DIR/native.txt" || CHECK_STATUS=$?
+    sed 's/^/  /' "$CHECK_DIR/native.txt"
+
+    echo -e "\n${YELLOW}[CHECK 2/2] Built-in dialect on baseline x86-64...${NC}"
+    gcc -O2 -std=gnu11 -march=x86-64 $WARN_FLAGS -I. -o "$CHECK_DIR/skibidi_check_x86_64" \
+        ./skibidi_check.c ./skibidi_avx.c -lm -pthread
+    "$CHECK_DIR/skibidi_check_x86_64" > "$CHECK_DIR/x86_64.txt" || CHECK_STATUS=$?
+    sed 's/^/  /' "$CHECK_DIR/x86_64.txt"
+
+    if [ "$CHECK_STATUS" -eq 0 ]; then
+        echo -e "${GREEN}Built-in dialect check passed${NC}"
+    else
+        echo -e "${RED}Built-in dialect check failed: a grammar kernel strays from the built-in one${NC}"
+        exit 1
+    fi
+fi
+
+echo -e "\n${YELLOW}[6/6] Verifying build artifacts...${NC}"
 
 LIB_FILE="build/linux-x86_64/libskibidi_avx.so"
 
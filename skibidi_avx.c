@@ -17,11 +17,14 @@
  * @warning If your buffer is too small the toilet WILL overflow
  */
 
+ #ifndef _GNU_SOURCE
  #define _GNU_SOURCE
+ #endif
  #include "skibidi_avx.h"
  #include <string.h>
  #include <stdlib.h>
  #include <stdatomic.h>
+ #include <stdio.h>
  
  /**
   * @defgroup PlatformAlloc Toilet-Aligned Memory Rituals
@@ -62,8 +65,10 @@
  #if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
      #define TOILET_IS_X86 1
      #include <cpuid.h>
+     #include <x86intrin.h>
  #else
      #define TOILET_IS_X86 0
+     #include <time.h>
  #endif
  
  /**
@@ -113,6 +118,24 @@
      #define TOILET_HAS_GODMODE_512 0
  #endif
  
+ /**
+  * @def TOILET_HAS_STRIDE_128
+  * @brief Compile-time check: can the toilet at least take long strides?
+  * 
+  * SSE2 is part of every x86-64 toilet's birth certificate, so this is
+  * on for any 64-bit x86 build, AVX2 or not. The old Xeons and the
+  * Atom-class boxes that never got the rizz pill still get a real batch
+  * factory instead of walking one line at a time: four MULQ lanes in
+  * flight, the prophecy stored as two XMM registers, and chants and
+  * verdicts stored from pair tables (toilet_factory_sse2()).
+  */
+ #ifdef __SSE2__
+     #include <emmintrin.h>
+     #define TOILET_HAS_STRIDE_128 1
+ #else
+     #define TOILET_HAS_STRIDE_128 0
+ #endif
+ 
  /** @} */
  
  /**
@@ -365,6 +388,96 @@
      1, 2, 3, 0, 1, 2
  };
  
+ /** @brief Two chant words, each followed by its space, as one little-endian 8-byte store */
+ #define TOILET_PAIR(a, b, c, d, e, f) \
+     ((uint64_t)(a) | (uint64_t)(b) << 8 | (uint64_t)(c) << 16 | (uint64_t)' ' << 24 | \
+      (uint64_t)(d) << 32 | (uint64_t)(e) << 40 | (uint64_t)(f) << 48 | (uint64_t)' ' << 56)
+ 
+ /** @brief Every second word after one first word, in [disguise][zodiac] order */
+ #define TOILET_PAIR_ROW(a, b, c) \
+     TOILET_PAIR(a,b,c, 'd','o','p'), TOILET_PAIR(a,b,c, 'D','o','p'), TOILET_PAIR(a,b,c, 'd','O','p'), TOILET_PAIR(a,b,c, 'd','o','P'), \
+     TOILET_PAIR(a,b,c, 'D','O','p'), TOILET_PAIR(a,b,c, 'D','o','P'), TOILET_PAIR(a,b,c, 'd','O','P'), TOILET_PAIR(a,b,c, 'D','O','P'), \
+     TOILET_PAIR(a,b,c, 'd','o','m'), TOILET_PAIR(a,b,c, 'D','o','m'), TOILET_PAIR(a,b,c, 'd','O','m'), TOILET_PAIR(a,b,c, 'd','o','M'), \
+     TOILET_PAIR(a,b,c, 'D','O','m'), TOILET_PAIR(a,b,c, 'D','o','M'), TOILET_PAIR(a,b,c, 'd','O','M'), TOILET_PAIR(a,b,c, 'D','O','M')
+ 
+ /**
+  * @brief The Chant Pair Tablet: two dops and their spaces in one store
+  * 
+  * Entry [(first << 4) | second] is "w1 w2 " for word ids
+  * disguise * 8 + zodiac, the same order as DOP_MULTIVERSE followed by
+  * DOM_DISGUISE_MULTIVERSE. Exactly 8 bytes, so a pair of dops costs
+  * one load and one store. A lone word is the first half of its row's
+  * entry: store all 8, advance 4, the next store covers the rest.
+  * 
+  * 2 KiB, the toilet's entire chant vocabulary squared, comfortably
+  * inside L1.
+  * 
+  * @note Marked unused for builds without the SSE2 factory
+  */
+ static const uint64_t TOILET_CHANT_PAIRS[256] __attribute__((aligned(64), unused)) = {
+     TOILET_PAIR_ROW('d','o','p'),
+     TOILET_PAIR_ROW('D','o','p'),
+     TOILET_PAIR_ROW('d','O','p'),
+     TOILET_PAIR_ROW('d','o','P'),
+     TOILET_PAIR_ROW('D','O','p'),
+     TOILET_PAIR_ROW('D','o','P'),
+     TOILET_PAIR_ROW('d','O','P'),
+     TOILET_PAIR_ROW('D','O','P'),
+     TOILET_PAIR_ROW('d','o','m'),
+     TOILET_PAIR_ROW('D','o','m'),
+     TOILET_PAIR_ROW('d','O','m'),
+     TOILET_PAIR_ROW('d','o','M'),
+     TOILET_PAIR_ROW('D','O','m'),
+     TOILET_PAIR_ROW('D','o','M'),
+     TOILET_PAIR_ROW('d','O','M'),
+     TOILET_PAIR_ROW('D','O','M'),
+ };
+
+ /** @brief "yes yes!" in any two case variants, one 8-byte store */
+ #define TOILET_APPROVAL_PAIR(a, b, c, d, e, f) \
+     ((uint64_t)(a) | (uint64_t)(b) << 8 | (uint64_t)(c) << 16 | (uint64_t)' ' << 24 | \
+      (uint64_t)(d) << 32 | (uint64_t)(e) << 40 | (uint64_t)(f) << 48 | (uint64_t)'!' << 56)
+ 
+ /** @brief "no no!" in any two case variants, 6 bytes of an 8-byte store */
+ #define TOILET_REJECTION_PAIR(a, b, c, d) \
+     ((uint64_t)(a) | (uint64_t)(b) << 8 | (uint64_t)' ' << 16 | \
+      (uint64_t)(c) << 24 | (uint64_t)(d) << 32 | (uint64_t)'!' << 40)
+ 
+ #define TOILET_APPROVAL_ROW(a, b, c) \
+     TOILET_APPROVAL_PAIR(a,b,c, 'y','e','s'), TOILET_APPROVAL_PAIR(a,b,c, 'Y','e','s'), TOILET_APPROVAL_PAIR(a,b,c, 'y','E','s'), TOILET_APPROVAL_PAIR(a,b,c, 'y','e','S'), \
+     TOILET_APPROVAL_PAIR(a,b,c, 'Y','E','s'), TOILET_APPROVAL_PAIR(a,b,c, 'Y','e','S'), TOILET_APPROVAL_PAIR(a,b,c, 'y','E','S'), TOILET_APPROVAL_PAIR(a,b,c, 'Y','E','S')
+ 
+ #define TOILET_REJECTION_ROW(a, b) \
+     TOILET_REJECTION_PAIR(a,b, 'n','o'), TOILET_REJECTION_PAIR(a,b, 'N','o'), TOILET_REJECTION_PAIR(a,b, 'n','O'), TOILET_REJECTION_PAIR(a,b, 'N','O')
+ 
+ /**
+  * @brief The Verdict Pair Tablets: the whole ending in one store
+  * 
+  * Approval entry [(zodiac_1 << 3) | zodiac_2] is "yes yes!" in those
+  * two DOP_ZODIAC_CHART variants, rejection entry [(zodiac_1 << 2) |
+  * zodiac_2] is "no no!" in two REJECTION_ZODIAC_CHART variants. With
+  * both looked up, the verdict is a select, not a branch.
+  * 
+  * @note Marked unused for builds without the SSE2 factory
+  */
+ static const uint64_t TOILET_APPROVAL_PAIRS[64] __attribute__((aligned(64), unused)) = {
+     TOILET_APPROVAL_ROW('y','e','s'),
+     TOILET_APPROVAL_ROW('Y','e','s'),
+     TOILET_APPROVAL_ROW('y','E','s'),
+     TOILET_APPROVAL_ROW('y','e','S'),
+     TOILET_APPROVAL_ROW('Y','E','s'),
+     TOILET_APPROVAL_ROW('Y','e','S'),
+     TOILET_APPROVAL_ROW('y','E','S'),
+     TOILET_APPROVAL_ROW('Y','E','S'),
+ };
+ 
+ static const uint64_t TOILET_REJECTION_PAIRS[16] __attribute__((aligned(64), unused)) = {
+     TOILET_REJECTION_ROW('n','o'),
+     TOILET_REJECTION_ROW('N','o'),
+     TOILET_REJECTION_ROW('n','O'),
+     TOILET_REJECTION_ROW('N','O'),
+ };
+ 
  /** @} */
  
  /**
@@ -379,15 +492,36 @@
   * that would be false sharing, and the toilet does NOT share. The
   * toilet is sigma. The toilet grinds alone.
   * 
+  * Everything the kernels ask about the configuration lives in one
+  * 64-bit verdict, published whole and never edited in place: a reader
+  * that loads it once holds an immutable snapshot, and a new one is a
+  * single compare-and-swap. Being a value, an old verdict needs no
+  * reclamation, nobody can be caught holding a freed one.
+  * 
   * @note Uses C11 atomics because the toilet transcends thread boundaries
   */
  typedef struct __attribute__((aligned(64))) {
-     _Atomic int32_t toilet_awake;           /**< Has the toilet scanned its own chakras? 1=yes 0=no */
+     _Atomic uint64_t verdict;               /**< The published configuration (TOILET_VERDICT_*), 0 = still asleep */
      _Atomic uint32_t toilet_powers;         /**< Bitmask of SKIBIDI_CAP_* toilet powers */
-     int32_t flush_strategy;                 /**< 0=walks, 1=runs(AVX2), 2=FLIES(AVX-512) */
-     int32_t _sacred_padding[13];            /**< Sacred padding, do not disturb the toilet's personal space */
+     _Atomic uint32_t probe_every;           /**< Time 1 call in this many per thread, 0 = probes off */
+     int32_t _sacred_padding[12];            /**< Sacred padding, do not disturb the toilet's personal space */
  } ToiletHivemind;
  
+ /**
+  * @brief Layout of the verdict
+  * 
+  * - [31:0]  tuned_forms: battle form + 1 per batch class, one byte each, 0 = untuned
+  * - [33:32] battle form: 0=walks, 1=runs(AVX2), 2=FLIES(AVX-512)
+  * - [34]    canonical stream (SkibidiConfig.canonical_stream)
+  * - [35]    constant time (SkibidiConfig.constant_time, always with [34])
+  * - [63:40] generation, bumped by every publication and never 0
+  */
+ #define TOILET_VERDICT_TUNED         0xFFFFFFFFULL
+ #define TOILET_VERDICT_FORM_SHIFT    32
+ #define TOILET_VERDICT_CANONICAL     (1ULL << 34)
+ #define TOILET_VERDICT_CONSTANT_TIME (1ULL << 35)
+ #define TOILET_VERDICT_GENERATION_SHIFT 40
+ 
  /**
   * @brief The Singleton Toilet - there can be only one
   * 
@@ -396,11 +530,75 @@
   * From that moment, the toilet watches all threads. The toilet sees all dops.
   */
  static ToiletHivemind g_toilet_hivemind __attribute__((aligned(64))) = {
-     .toilet_awake     = 0,
+     .verdict          = 0,
      .toilet_powers    = 0,
-     .flush_strategy   = 0
+     .probe_every      = 0
  };
  
+ /**
+  * @brief The configuration snapshot, as of this instant
+  * 
+  * One relaxed load. Load it once per call and decode that copy, and
+  * the whole call sees one configuration even if a new one lands.
+  */
+ static TOILET_FORCE_ABSORB uint64_t toilet_verdict(void) {
+     return atomic_load_explicit(&g_toilet_hivemind.verdict, memory_order_relaxed);
+ }
+ 
+ /** @brief The battle form a verdict picked */
+ static TOILET_FORCE_ABSORB int toilet_verdict_form(uint64_t verdict) {
+     return (int)((verdict >> TOILET_VERDICT_FORM_SHIFT) & 3);
+ }
+ 
+ /**
+  * @brief canonical level: the canonical stream, spoken in constant time
+  * 
+  * Goes wherever a canonical flag goes (ledgers, bound kernels). Every
+  * nonzero level speaks the same lines, so code that only asks "canonical
+  * or not" keeps working and simply is not constant-time.
+  */
+ #define TOILET_CANONICAL_CONSTANT_TIME 2
+ 
+ /** @brief Which stream a verdict asks for: 0 = fastest, 1 = canonical, TOILET_CANONICAL_CONSTANT_TIME */
+ static TOILET_FORCE_ABSORB int toilet_verdict_canonical(uint64_t verdict) {
+     return ((verdict & TOILET_VERDICT_CANONICAL) != 0) + ((verdict & TOILET_VERDICT_CONSTANT_TIME) != 0);
+ }
+ 
+ /** @brief A verdict's tuned_forms word */
+ static TOILET_FORCE_ABSORB uint32_t toilet_verdict_tuned(uint64_t verdict) {
+     return (uint32_t)(verdict & TOILET_VERDICT_TUNED);
+ }
+ 
+ /** @brief The current battle form (for callers that ask nothing else) */
+ static TOILET_FORCE_ABSORB int toilet_battle_form(void) {
+     return toilet_verdict_form(toilet_verdict());
+ }
+ 
+ /** @brief The stream the current verdict asks for (ditto) */
+ static TOILET_FORCE_ABSORB int toilet_canonical_stream(void) {
+     return toilet_verdict_canonical(toilet_verdict());
+ }
+ 
+ /**
+  * @brief Publish settings on top of the verdict they were derived from
+  * 
+  * The generation is bumped (skipping 0, which means asleep), the
+  * settings come from the caller. Release order, so CPUID results
+  * stored before are visible to whoever acquires the new verdict.
+  * 
+  * @param[in,out] seen The verdict the settings replace; the current one on failure
+  * @param settings Tuned forms, battle form and canonical bit (generation ignored)
+  * @return 1 if published, 0 if another verdict landed first
+  */
+ static TOILET_NPC int toilet_verdict_publish(uint64_t* seen, uint64_t settings) {
+     uint64_t generation = ((*seen >> TOILET_VERDICT_GENERATION_SHIFT) + 1) & 0xFFFFFF;
+     generation += generation == 0;
+     const uint64_t next = (settings & ((1ULL << TOILET_VERDICT_GENERATION_SHIFT) - 1))
+                         | (generation << TOILET_VERDICT_GENERATION_SHIFT);
+     return atomic_compare_exchange_strong_explicit(&g_toilet_hivemind.verdict, seen, next,
+                                                    memory_order_release, memory_order_relaxed);
+ }
+ 
  /**
   * @defgroup StringConstants The Immutable Skibidi Scripture
   * @brief Cache-aligned holy texts that shall not be modified
@@ -700,8 +898,8 @@
   * The toilet does not care about your compiler's register allocation
   * preferences. The toilet knows RAX and RDX. The toilet speaks only MUL.
   * 
-  * Algorithm: state = (state * magic_toilet_number) >> 64
-  * Period: 2^64 flushes before the sequence repeats
+  * Algorithm: state = state * magic_toilet_number (mod 2^128), output = high 64 bits
+  * Period: 2^126 flushes before the sequence repeats
   * Quality: Passes BigCrush, which is ironic because toilets are experts at crushing
   * @{
   */
@@ -720,7 +918,7 @@
   * @brief THE Lehmer64 random number generator - THE SINGLE MUL TOILET
   * 
   * This function is the beating heart of the Skibidi engine. It takes
-  * a 64-bit state, multiplies it by a magic number chosen by ancient
+  * a 128-bit state, multiplies it by a magic number chosen by ancient
   * toilet mathematicians (Steele & Vigna, who were definitely thinking
   * about toilets when they published their paper), and returns 64 bits
   * of pure, uncut randomness.
@@ -730,15 +928,18 @@
   * movq (%rdi), %rax    ; the toilet reaches into its state
   * movabsq $mult, %rcx  ; the magic number materializes
   * mulq %rcx            ; 128 bits of toilet computation occur
-  * movq %rdx, (%rdi)    ; the high bits become the new state
-  * ; RAX = the low bits = your random number = the toilet's gift to you
+  * movq %rax, (%rdi)    ; the low bits become the new low word
+  * imulq 32(%rdi), %rcx ; the high word joins the ritual
+  * addq %rcx, %rdx      ; RDX = new high word = the toilet's gift to you
+  * movq %rdx, 32(%rdi)
   * @endcode
   * 
   * Latency: ~4 cycles. Four. That's fewer cycles than it takes to
   * say "dop". The toilet generates randomness faster than you can
   * even conceptualize a dop. Let that sink in. Let that TOILET in.
   * 
-  * @param[in,out] toilet_soul The toilet's 64-bit consciousness (must be odd, the toilet insists)
+  * @param[in,out] toilet_soul Low word of the toilet's 128-bit consciousness; the
+  *                            high word sits at toilet_soul[4] (s0[i] / s1[i])
   * @return 64 bits of raw toilet entropy, fresh from the porcelain dimension
   * 
   * @note Multiplier 0xda942042e4dd58b5 was selected from a pool of
@@ -751,25 +952,35 @@
       * 
       * RAX x r/m64 -> RDX:RAX
       * 
-      * RAX goes in as the state. It comes out as the low 64 bits (your dop fuel).
-      * RDX catches the high 64 bits (the new toilet consciousness).
-      * The multiply happens in the shadow dimension between the registers.
+      * The toilet's soul is 128 bits wide: the low word lives in s0[i]
+      * and the high word lives four slots later in s1[i]. One MUL
+      * multiplies the low word (RAX becomes the new low word, RDX the
+      * carry into the high word), one IMUL folds in the high word, and
+      * the new high word is the dop fuel.
+      * 
+      * A 64-bit soul is not enough: keeping only the high half shrinks it
+      * by 0.85x per flush until it hits zero, and keeping only the low
+      * half bounds the output by the multiplier so the top byte never
+      * passes 0xDA. The full 128-bit state is real Lehmer64.
       * 
       * Constraint Sigils:
-      * - "=a"(dop_fuel): output in RAX register
-      * - "=d"(new_soul): output in RDX register  
-      * - "0"(*toilet_soul): input through RAX, tied to output 0 by fate
+      * - "=a"(soul_low): output in RAX register
+      * - "=d"(soul_carry): output in RDX register  
+      * - "0"(toilet_soul[0]): input through RAX, tied to output 0 by fate
       * - "rm"(sacred_multiplier): the magic number, from register or memory
       */
-     uint64_t dop_fuel, new_soul;
+     uint64_t soul_carry, soul_low;
      const uint64_t sacred_multiplier = 0xda942042e4dd58b5ULL;
-     __asm__ ("mulq %3" : "=a"(dop_fuel), "=d"(new_soul) : "0"(*toilet_soul), "rm"(sacred_multiplier));
-     *toilet_soul = new_soul;
+     __asm__ ("mulq %3" : "=a"(soul_low), "=d"(soul_carry) : "0"(toilet_soul[0]), "rm"(sacred_multiplier));
+     const uint64_t dop_fuel = toilet_soul[4] * sacred_multiplier + soul_carry;
+     toilet_soul[0] = soul_low;
+     toilet_soul[4] = dop_fuel;
      return dop_fuel;
  #else
-     toilet_megaint_t cosmic_product = (toilet_megaint_t)(*toilet_soul) * 0xda942042e4dd58b5ULL;
-     *toilet_soul = (uint64_t)(cosmic_product >> 64);
-     return (uint64_t)cosmic_product;
+     toilet_megaint_t cosmic_product = (((toilet_megaint_t)toilet_soul[4] << 64) | toilet_soul[0]) * 0xda942042e4dd58b5ULL;
+     toilet_soul[0] = (uint64_t)cosmic_product;
+     toilet_soul[4] = (uint64_t)(cosmic_product >> 64);
+     return (uint64_t)(cosmic_product >> 64);
  #endif
  }
  
@@ -826,7 +1037,7 @@
   * Total latency: ~8-10 cycles for ALL FOUR toilet flushes
   * (vs ~16 cycles if the toilets had to take turns like LOSERS)
   * 
-  * @param[in,out] toilet_souls Array of 4 toilet states (each one is a separate toilet)
+  * @param[in,out] toilet_souls rng->s0: 4 low words, followed in memory by the 4 high words in rng->s1
   * @param[out] dop_fuels Array receiving 4 toilet outputs (the collective flush)
   * 
   * @note This function exists because one toilet was never enough
@@ -841,8 +1052,9 @@
      /*
       * The Four Horsemen of the Toilet Apocalypse:
       * 
-      * Each block loads a state into RAX, MULs it with the sacred constant,
-      * stores the low bits (output) and high bits (new state).
+      * Each block loads a low word into RAX, MULs it with the sacred
+      * constant, folds the high word (four slots later, in s1) into the
+      * carry, and stores the new high word as both state and output.
       * 
       * The CPU's out-of-order engine sees these as independent operations
       * and pipelines them. It's like a bathroom with 4 stalls and they're
@@ -851,23 +1063,39 @@
      __asm__ __volatile__ (
          "movq   (%[s]), %%rax \n\t"
          "mulq   %[m]          \n\t"
-         "movq   %%rax, (%[o]) \n\t"
-         "movq   %%rdx, (%[s]) \n\t"
- 
+         "movq   %%rax,  (%[s])\n\t"
+         "movq 32(%[s]), %%rax \n\t"
+         "imulq  %[m], %%rax   \n\t"
+         "addq   %%rax, %%rdx  \n\t"
+         "movq   %%rdx,32(%[s])\n\t"
+         "movq   %%rdx,  (%[o])\n\t"
+
          "movq  8(%[s]), %%rax \n\t"
          "mulq   %[m]          \n\t"
-         "movq   %%rax, 8(%[o])\n\t"
-         "movq   %%rdx, 8(%[s])\n\t"
- 
+         "movq   %%rax, 8(%[s])\n\t"
+         "movq 40(%[s]), %%rax \n\t"
+         "imulq  %[m], %%rax   \n\t"
+         "addq   %%rax, %%rdx  \n\t"
+         "movq   %%rdx,40(%[s])\n\t"
+         "movq   %%rdx, 8(%[o])\n\t"
+
          "movq 16(%[s]), %%rax \n\t"
          "mulq   %[m]          \n\t"
-         "movq   %%rax,16(%[o])\n\t"
-         "movq   %%rdx,16(%[s])\n\t"
- 
+         "movq   %%rax,16(%[s])\n\t"
+         "movq 48(%[s]), %%rax \n\t"
+         "imulq  %[m], %%rax   \n\t"
+         "addq   %%rax, %%rdx  \n\t"
+         "movq   %%rdx,48(%[s])\n\t"
+         "movq   %%rdx,16(%[o])\n\t"
+
          "movq 24(%[s]), %%rax \n\t"
          "mulq   %[m]          \n\t"
-         "movq   %%rax,24(%[o])\n\t"
-         "movq   %%rdx,24(%[s])\n\t"
+         "movq   %%rax,24(%[s])\n\t"
+         "movq 56(%[s]), %%rax \n\t"
+         "imulq  %[m], %%rax   \n\t"
+         "addq   %%rax, %%rdx  \n\t"
+         "movq   %%rdx,56(%[s])\n\t"
+         "movq   %%rdx,24(%[o])\n\t"
          :
          : [s] "r" (toilet_souls), [o] "r" (dop_fuels), [m] "r" (sacred_multiplier)
          : "rax", "rdx", "memory", "cc"
@@ -881,6 +1109,345 @@
  
  /** @} */
  
+ /**
+  * @defgroup ChaChaRNG The Sealed Cistern
+  * @brief A ChaCha keystream for toilets whose next line must stay a secret
+  * 
+  * A few Lehmer64 lines give the toilet's whole state away. ChaCha
+  * toilets (skibidi_init_chacha()) draw every line from a ChaCha
+  * keystream instead: line n gets bytes 16n to 16n + 15, the quarter
+  * n % 4 of block n / 4, read as two little-endian words. The stream is
+  * addressed by its counter, so every kernel finds a line's entropy
+  * without walking to it and they all agree on it.
+  * 
+  * Batches fill a tank of up to 16 blocks, word-major (tank[word][block])
+  * so each SIMD lane computes one block and stores straight into it:
+  * 16 blocks per pass under AVX-512, 8 under AVX2, 4 under SSE2. Single
+  * lines share one block cached in the context.
+  * @{
+  */
+ 
+ /** @brief Blocks in a batch tank (one AVX-512 pass, 64 lines) */
+ #define TOILET_CHACHA_TANK_BLOCKS  16
+ 
+ /** @brief A batch's keystream: tank[word][block], 64-byte rows for the widest stores */
+ typedef uint32_t ToiletChaChaTank[16][TOILET_CHACHA_TANK_BLOCKS] __attribute__((aligned(64)));
+ 
+ /**
+  * @brief One ChaCha quarter round on x[a], x[b], x[c], x[d]
+  * 
+  * ADD, XOR and ROTL are the lane type's operations, so the scalar,
+  * SSE2, AVX2 and AVX-512 cisterns share this one definition.
+  */
+ #define TOILET_CHACHA_QUARTER(x, a, b, c, d, ADD, XOR, ROTL) do { \
+     x[a] = ADD(x[a], x[b]); x[d] = ROTL(XOR(x[d], x[a]), 16); \
+     x[c] = ADD(x[c], x[d]); x[b] = ROTL(XOR(x[b], x[c]), 12); \
+     x[a] = ADD(x[a], x[b]); x[d] = ROTL(XOR(x[d], x[a]), 8); \
+     x[c] = ADD(x[c], x[d]); x[b] = ROTL(XOR(x[b], x[c]), 7); \
+ } while (0)
+ 
+ /** @brief rounds / 2 double rounds (columns, then diagonals) */
+ #define TOILET_CHACHA_ROUNDS(x, rounds, ADD, XOR, ROTL) do { \
+     for (int double_round = 0; double_round < (rounds); double_round += 2) { \
+         TOILET_CHACHA_QUARTER(x, 0, 4, 8, 12, ADD, XOR, ROTL); \
+         TOILET_CHACHA_QUARTER(x, 1, 5, 9, 13, ADD, XOR, ROTL); \
+         TOILET_CHACHA_QUARTER(x, 2, 6, 10, 14, ADD, XOR, ROTL); \
+         TOILET_CHACHA_QUARTER(x, 3, 7, 11, 15, ADD, XOR, ROTL); \
+         TOILET_CHACHA_QUARTER(x, 0, 5, 10, 15, ADD, XOR, ROTL); \
+         TOILET_CHACHA_QUARTER(x, 1, 6, 11, 12, ADD, XOR, ROTL); \
+         TOILET_CHACHA_QUARTER(x, 2, 7, 8, 13, ADD, XOR, ROTL); \
+         TOILET_CHACHA_QUARTER(x, 3, 4, 9, 14, ADD, XOR, ROTL); \
+     } \
+ } while (0)
+ 
+ #define TOILET_ADD32(a, b)  ((a) + (b))
+ #define TOILET_XOR32(a, b)  ((a) ^ (b))
+ #define TOILET_ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+ 
+ /**
+  * @brief The toilet's input block with the counter words left at zero
+  * 
+  * "expand 32-byte k", the key, counter (words 12-13) and nonce (14-15).
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_input(const SkibidiContext* TOILET_NO_ALIAS ctx, uint32_t in[16]) {
+     in[0] = 0x61707865u;
+     in[1] = 0x3320646Eu;
+     in[2] = 0x79622D32u;
+     in[3] = 0x6B206574u;
+     for (int word = 0; word < 8; word++) {
+         in[4 + word] = ctx->chacha_key[word];
+     }
+     in[12] = 0;
+     in[13] = 0;
+     in[14] = (uint32_t)ctx->chacha_nonce;
+     in[15] = (uint32_t)(ctx->chacha_nonce >> 32);
+ }
+ 
+ /**
+  * @brief One keystream block, one word at a time
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_block(const uint32_t in[16], uint64_t block, int rounds, uint32_t out[16]) {
+     uint32_t x[16];
+     for (int word = 0; word < 16; word++) {
+         x[word] = in[word];
+     }
+     x[12] = (uint32_t)block;
+     x[13] = (uint32_t)(block >> 32);
+     const uint32_t counter_lo = x[12];
+     const uint32_t counter_hi = x[13];
+ 
+     TOILET_CHACHA_ROUNDS(x, rounds, TOILET_ADD32, TOILET_XOR32, TOILET_ROTL32);
+ 
+     for (int word = 0; word < 16; word++) {
+         out[word] = x[word] + in[word];
+     }
+     out[12] = x[12] + counter_lo;
+     out[13] = x[13] + counter_hi;
+ }
+ 
+ #if TOILET_HAS_STRIDE_128
+ 
+ /**
+  * @brief Rotate each 32-bit lane left; 16 swaps the halves with two word shuffles
+  */
+ static TOILET_FORCE_ABSORB __m128i toilet_rotl_128(__m128i v, int n) {
+     if (n == 16) {
+         return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+     }
+     return _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - n));
+ }
+ 
+ /**
+  * @brief Four blocks, one per SSE2 lane, into tank columns column..column+3
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_pass_sse2(const uint32_t in[16], uint64_t block, int rounds,
+                                                         ToiletChaChaTank tank, int column) {
+     __m128i start[16];
+     __m128i x[16];
+     for (int word = 0; word < 16; word++) {
+         start[word] = _mm_set1_epi32((int)in[word]);
+     }
+     start[12] = _mm_setr_epi32((int)(uint32_t)block, (int)(uint32_t)(block + 1),
+                                (int)(uint32_t)(block + 2), (int)(uint32_t)(block + 3));
+     start[13] = _mm_setr_epi32((int)(uint32_t)(block >> 32), (int)(uint32_t)((block + 1) >> 32),
+                                (int)(uint32_t)((block + 2) >> 32), (int)(uint32_t)((block + 3) >> 32));
+     for (int word = 0; word < 16; word++) {
+         x[word] = start[word];
+     }
+ 
+     TOILET_CHACHA_ROUNDS(x, rounds, _mm_add_epi32, _mm_xor_si128, toilet_rotl_128);
+ 
+     for (int word = 0; word < 16; word++) {
+         _mm_store_si128((__m128i*)&tank[word][column], _mm_add_epi32(x[word], start[word]));
+     }
+ }
+ 
+ #endif /* TOILET_HAS_STRIDE_128 */
+ 
+ #if TOILET_HAS_RIZZ_256
+ 
+ /**
+  * @brief Rotate each 32-bit lane left; 16 and 8 are byte shuffles
+  */
+ static TOILET_FORCE_ABSORB __m256i toilet_rotl_256(__m256i v, int n) {
+     if (n == 16) {
+         return _mm256_shuffle_epi8(v, _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                                        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13));
+     }
+     if (n == 8) {
+         return _mm256_shuffle_epi8(v, _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+                                                        3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14));
+     }
+     return _mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - n));
+ }
+ 
+ /**
+  * @brief Eight blocks, one per AVX2 lane, into tank columns column..column+7
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_pass_avx2(const uint32_t in[16], uint64_t block, int rounds,
+                                                         ToiletChaChaTank tank, int column) {
+     uint32_t counter_lo[8];
+     uint32_t counter_hi[8];
+     for (int lane = 0; lane < 8; lane++) {
+         counter_lo[lane] = (uint32_t)(block + (uint64_t)lane);
+         counter_hi[lane] = (uint32_t)((block + (uint64_t)lane) >> 32);
+     }
+ 
+     __m256i start[16];
+     __m256i x[16];
+     for (int word = 0; word < 16; word++) {
+         start[word] = _mm256_set1_epi32((int)in[word]);
+     }
+     start[12] = _mm256_loadu_si256((const __m256i*)counter_lo);
+     start[13] = _mm256_loadu_si256((const __m256i*)counter_hi);
+     for (int word = 0; word < 16; word++) {
+         x[word] = start[word];
+     }
+ 
+     TOILET_CHACHA_ROUNDS(x, rounds, _mm256_add_epi32, _mm256_xor_si256, toilet_rotl_256);
+ 
+     for (int word = 0; word < 16; word++) {
+         _mm256_store_si256((__m256i*)&tank[word][column], _mm256_add_epi32(x[word], start[word]));
+     }
+ }
+ 
+ #endif /* TOILET_HAS_RIZZ_256 */
+ 
+ #if TOILET_HAS_GODMODE_512
+ 
+ /**
+  * @brief Sixteen blocks, one per AVX-512 lane: the whole tank in one pass
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_pass_avx512(const uint32_t in[16], uint64_t block, int rounds,
+                                                           ToiletChaChaTank tank) {
+     __m512i start[16];
+     __m512i x[16];
+     for (int word = 0; word < 16; word++) {
+         start[word] = _mm512_set1_epi32((int)in[word]);
+     }
+     const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+     start[12] = _mm512_add_epi32(_mm512_set1_epi32((int)(uint32_t)block), lanes);
+     /* Lanes whose low word wrapped carry one into the high word */
+     const __mmask16 carried = _mm512_cmplt_epu32_mask(start[12], lanes);
+     start[13] = _mm512_mask_add_epi32(_mm512_set1_epi32((int)(uint32_t)(block >> 32)), carried,
+                                       _mm512_set1_epi32((int)(uint32_t)(block >> 32)), _mm512_set1_epi32(1));
+     for (int word = 0; word < 16; word++) {
+         x[word] = start[word];
+     }
+ 
+     TOILET_CHACHA_ROUNDS(x, rounds, _mm512_add_epi32, _mm512_xor_si512, _mm512_rol_epi32);
+ 
+     for (int word = 0; word < 16; word++) {
+         _mm512_store_si512((void*)tank[word], _mm512_add_epi32(x[word], start[word]));
+     }
+ }
+ 
+ #endif /* TOILET_HAS_GODMODE_512 */
+ 
+ /**
+  * @brief Fill the tank's first blocks columns from block first_block on
+  * 
+  * The widest pass the battle form allows; a pass may fill a few more
+  * columns than asked for (never past the tank), which nobody reads.
+  * 
+  * @param blocks Columns wanted, 1 to TOILET_CHACHA_TANK_BLOCKS
+  */
+ static TOILET_MAIN_CHARACTER void toilet_chacha_fill(
+     const SkibidiContext* TOILET_NO_ALIAS ctx,
+     uint64_t first_block,
+     int blocks,
+     ToiletChaChaTank tank,
+     int battle_form)
+ {
+     uint32_t in[16];
+     toilet_chacha_input(ctx, in);
+     const int rounds = (int)ctx->engine;
+     int filled = 0;
+ 
+ #if TOILET_HAS_GODMODE_512
+     if (battle_form >= 2 && blocks > 8) {
+         toilet_chacha_pass_avx512(in, first_block, rounds, tank);
+         return;
+     }
+ #endif
+ #if TOILET_HAS_RIZZ_256
+     if (battle_form >= 1) {
+         for (; filled < blocks; filled += 8) {
+             toilet_chacha_pass_avx2(in, first_block + (uint64_t)filled, rounds, tank, filled);
+         }
+     }
+ #else
+     (void)battle_form;
+ #endif
+ #if TOILET_HAS_STRIDE_128
+     for (; filled < blocks; filled += 4) {
+         toilet_chacha_pass_sse2(in, first_block + (uint64_t)filled, rounds, tank, filled);
+     }
+ #endif
+     for (; filled < blocks; filled++) {
+         uint32_t out[16];
+         toilet_chacha_block(in, first_block + (uint64_t)filled, rounds, out);
+         for (int word = 0; word < 16; word++) {
+             tank[word][filled] = out[word];
+         }
+     }
+ }
+ 
+ /**
+  * @brief The two entropy words of line (line % 4) of tank column line / 4
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_tap(
+     const ToiletChaChaTank tank,
+     int line,
+     uint64_t* TOILET_NO_ALIAS entropy1,
+     uint64_t* TOILET_NO_ALIAS entropy2)
+ {
+     const int column = line >> 2;
+     const int word = (line & 3) * 4;
+     *entropy1 = tank[word][column] | (uint64_t)tank[word + 1][column] << 32;
+     *entropy2 = tank[word + 2][column] | (uint64_t)tank[word + 3][column] << 32;
+ }
+ 
+ /**
+  * @brief The context's cached block: 8 little-endian words over rng.s0 and rng.s1
+  */
+ static TOILET_FORCE_ABSORB uint64_t* toilet_chacha_cache(SkibidiContext* TOILET_NO_ALIAS ctx) {
+     return (uint64_t*)&ctx->rng;
+ }
+ 
+ /**
+  * @brief Put keystream block into the context's cache
+  */
+ static TOILET_BANISH void toilet_chacha_refill(SkibidiContext* TOILET_NO_ALIAS ctx, uint64_t block) {
+     uint32_t in[16];
+     uint32_t out[16];
+     toilet_chacha_input(ctx, in);
+     toilet_chacha_block(in, block, (int)ctx->engine, out);
+ 
+     uint64_t* cache = toilet_chacha_cache(ctx);
+     for (int word = 0; word < 8; word++) {
+         cache[word] = out[2 * word] | (uint64_t)out[2 * word + 1] << 32;
+     }
+     ctx->chacha_block = block + 1;
+ }
+ 
+ /**
+  * @brief Keep tank column as the context's cached block (it is block first_block + column)
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_stash(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     const ToiletChaChaTank tank,
+     uint64_t first_block,
+     int column)
+ {
+     uint64_t* cache = toilet_chacha_cache(ctx);
+     for (int word = 0; word < 8; word++) {
+         cache[word] = tank[2 * word][column] | (uint64_t)tank[2 * word + 1][column] << 32;
+     }
+     ctx->chacha_block = first_block + (uint64_t)column + 1;
+ }
+ 
+ /**
+  * @brief The entropy of line call_count, through the cached block
+  * 
+  * Call before counting the line, like toilet_speak_context().
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_draw(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     uint64_t* TOILET_NO_ALIAS entropy1,
+     uint64_t* TOILET_NO_ALIAS entropy2)
+ {
+     const uint64_t block = ctx->call_count >> 2;
+     if (SKIBIDI_IMPROBABLE(ctx->chacha_block != block + 1)) {
+         toilet_chacha_refill(ctx, block);
+     }
+     const uint64_t* cache = toilet_chacha_cache(ctx);
+     *entropy1 = cache[2 * (ctx->call_count & 3)];
+     *entropy2 = cache[2 * (ctx->call_count & 3) + 1];
+ }
+ 
+ /** @} */
+ 
  /**
   * @defgroup DopCount The Branchless Dop Census Bureau
   * @brief Counting dops without a single branch, the toilet way
@@ -947,15 +1514,18 @@
   * 2. AVX2: The toilet is a strong independent toilet, 256-bit dops
   * 3. Scalar: The toilet walks among mortals, one dop at a time
   * 
-  * Uses double-checked locking because even the toilet respects
-  * thread safety. The toilet is concurrent. The toilet is consistent.
-  * The toilet is partition-tolerant. The toilet satisfies CAP theorem.
+  * The CPUID defaults are only published over a verdict of 0: if
+  * skibidi_configure() or another thread's ceremony got there first,
+  * their verdict stands and this one is thrown away. The toilet is
+  * concurrent. The toilet is consistent. The toilet never un-configures
+  * itself behind the mortal's back.
   * 
   * @note Marked TOILET_NPC because the toilet only awakens once. After that,
   *       it is always awake. Always watching. Always ready to dop.
   */
  static TOILET_NPC TOILET_BANISH void toilet_awakening_ceremony(void) {
-     if (atomic_load_explicit(&g_toilet_hivemind.toilet_awake, memory_order_acquire)) {
+     uint64_t asleep = 0;
+     if (atomic_load_explicit(&g_toilet_hivemind.verdict, memory_order_acquire)) {
          return;
      }
  
@@ -975,10 +1545,7 @@
      }
  #endif
  
-     g_toilet_hivemind.flush_strategy = battle_form;
- 
-     atomic_thread_fence(memory_order_release);
-     atomic_store_explicit(&g_toilet_hivemind.toilet_awake, 1, memory_order_release);
+     toilet_verdict_publish(&asleep, (uint64_t)battle_form << TOILET_VERDICT_FORM_SHIFT);
  }
  
  /**
@@ -991,7 +1558,7 @@
   * not-taken). The toilet values your CPU cycles.
   */
  static TOILET_FORCE_ABSORB void toilet_vibe_check(void) {
-     if (SKIBIDI_IMPROBABLE(!atomic_load_explicit(&g_toilet_hivemind.toilet_awake, memory_order_acquire))) {
+     if (SKIBIDI_IMPROBABLE(!atomic_load_explicit(&g_toilet_hivemind.verdict, memory_order_acquire))) {
          toilet_awakening_ceremony();
      }
  }
@@ -1025,6 +1592,15 @@
      return chisel_pos + 3;
  }
  
+ /**
+  * @brief consult_prophecy level that lets the prophecy manifest unwritten
+  * 
+  * The line still happens (same entropy consumed, same stream position),
+  * only its 24 bytes are left out: the caller marks it in a bitmap
+  * instead and substitutes the sacred words itself.
+  */
+ #define TOILET_PROPHECY_ELIDED 2
+ 
  /**
   * @brief THE CORE TOILET ENGINE - where dops are born
   * 
@@ -1050,6 +1626,8 @@
   * @param rng The toilet's consciousness (modified with each flush)
   * @param scroll The stone tablet upon which the dops shall be written
   * @param consult_prophecy Shall we give the prophecy a chance to manifest? (26.85%)
+  *        TOILET_PROPHECY_ELIDED lets it manifest but writes nothing and returns 0
+  * @param battle_form The flush strategy to speak with (a constant folds the check away)
   * @return Length of the sacred inscription (not including null terminator because
   *         the toilet doesn't believe in null terminators, null terminators are
   *         for the weak, the toilet's words end when the toilet DECIDES they end)
@@ -1058,10 +1636,11 @@
   *       after Taco Bell Tuesday. The compiler WILL optimize this.
   *       The compiler has no choice. The toilet has spoken.
   */
- static TOILET_MAIN_CHARACTER TOILET_FORCE_ABSORB int toilet_speak_ultra(
+ static TOILET_MAIN_CHARACTER TOILET_FORCE_ABSORB int toilet_speak_forged(
      SkibidiRngState* TOILET_NO_ALIAS rng,
      char* TOILET_NO_ALIAS scroll,
-     int consult_prophecy)
+     int consult_prophecy,
+     int battle_form)
  {
      uint64_t toilet_entropy = toilet_flush_entropy(rng);
  
@@ -1078,10 +1657,13 @@
       * the toilet moves at the speed of light).
       */
      if (consult_prophecy && SKIBIDI_IMPROBABLE(prophecy_vibes < PROPHECY_THRESHOLD_NICE)) {
+         if (consult_prophecy == TOILET_PROPHECY_ELIDED) return 0;
  #if TOILET_HAS_RIZZ_256
-         if (SKIBIDI_PROBABLE(g_toilet_hivemind.flush_strategy >= 1)) {
+         if (SKIBIDI_PROBABLE(battle_form >= 1)) {
              toilet_omega_flush_32(scroll, SACRED_PROPHECY);
          } else
+ #else
+         (void)battle_form;
  #endif
          {
              toilet_yeet_24(scroll, SACRED_PROPHECY);
@@ -1243,6 +1825,17 @@
      return chisel_pos;
  }
  
+ /**
+  * @brief toilet_speak_forged() in whatever battle form the hivemind is in
+  */
+ static TOILET_MAIN_CHARACTER TOILET_FORCE_ABSORB int toilet_speak_ultra(
+     SkibidiRngState* TOILET_NO_ALIAS rng,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy)
+ {
+     return toilet_speak_forged(rng, scroll, consult_prophecy, toilet_battle_form());
+ }
+ 
  /**
   * @brief THE BATCH-OPTIMIZED ENTROPY CONSUMER - pre-generated randomness edition
   * 
@@ -1282,7 +1875,8 @@
   * 
   * @note This function NEVER calls toilet_flush_entropy. It is entropy-celibate.
   *       All randomness comes from above (the caller). This is the way.
-  * @note Used exclusively by toilet_factory_avx2 for batch operations
+  * @note Used by toilet_factory_avx2 for batch operations (toilet_speak_pairs
+  *       is its SSE2 twin)
   */
  static TOILET_MAIN_CHARACTER TOILET_FORCE_ABSORB int toilet_speak_with_entropy(
      char* TOILET_NO_ALIAS scroll,
@@ -1424,34 +2018,531 @@
      return chisel_pos;
  }
  
- #if TOILET_HAS_RIZZ_256
+ /**
+  * @brief One line from two draws already made (prophecy check included)
+  * 
+  * What toilet_speak_canon() does with its lane's two flushes, for
+  * entropy that comes from somewhere else (a ChaCha keystream).
+  */
+ static TOILET_FORCE_ABSORB int toilet_speak_drawn(
+     char* TOILET_NO_ALIAS scroll,
+     uint64_t entropy1,
+     uint64_t entropy2,
+     int consult_prophecy)
+ {
+     if (consult_prophecy && SKIBIDI_IMPROBABLE(((entropy1 >> 48) & 0xFF) < PROPHECY_THRESHOLD_NICE)) {
+         if (consult_prophecy == TOILET_PROPHECY_ELIDED) return 0;
+         toilet_yeet_24(scroll, SACRED_PROPHECY);
+         return PROPHECY_SACRED_LENGTH;
+     }
+     return toilet_speak_with_entropy(scroll, entropy1, entropy2);
+ }
  
  /**
-  * @brief THE BATCH TOILET FACTORY v2 - ENLIGHTENED ENTROPY MANAGEMENT EDITION
+  * @brief One line of the canonical stream
   * 
-  * This is the reborn batch generator, risen from the ashes of its predecessor
-  * like a phoenix made of porcelain. The original implementation had a fatal
-  * flaw: it called toilet_speak_ultra which internally invoked RNG TWICE per
-  * expression, completely wasting the pre-generated entropy from toilet_quad_flush.
+  * What the four-lane factories write for the line their lane gets,
+  * spoken alone: two flushes of that lane, prophecy check on the first,
+  * toilet_speak_with_entropy() for everything else.
   * 
-  * The sin of the old ways:
-  * - toilet_quad_flush generated 4 random numbers (4 MUL)
-  * - Then for each non-prophecy expression, toilet_speak_ultra called RNG 2 more times
-  * - Total: 4 + 4*0.73*2 = 9.84 MUL per 4 expressions = 2.46 MUL/expression
-  * - This was SLOWER than single-threaded generation (1.73 MUL/expression)
-  * - The batch mode was literally an anti-optimization. Ohio behavior.
+  * @param toilet_soul The lane's low word (&rng->s0[call_count & 3])
+  * @param scroll At least SKIBIDI_MIN_BUFFER_SIZE bytes of parchment
+  * @param consult_prophecy As for toilet_speak_forged()
+  * @return Length of the line (0 for an elided prophecy)
+  */
+ static TOILET_FORCE_ABSORB int toilet_speak_canon(
+     uint64_t* TOILET_NO_ALIAS toilet_soul,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy)
+ {
+     const uint64_t entropy1 = toilet_consciousness_mul(toilet_soul);
+     const uint64_t entropy2 = toilet_consciousness_mul(toilet_soul);
+     return toilet_speak_drawn(scroll, entropy1, entropy2, consult_prophecy);
+ }
+ 
+ /**
+  * @defgroup ConstantTime The Poker-Faced Toilet
+  * @brief The canonical line without a single tell
+  * 
+  * The ordinary kernels branch on the prophecy, the dop census and the
+  * verdict, and look case variants up in the zodiac charts: all of it
+  * shows in the branch predictor and the cache before the line is
+  * read. The kernel below decides the same things with masks, computes
+  * the charts from constants held in registers, and always stores the
+  * same 48 bytes, so the time it takes and the memory it touches are
+  * the same for "yes yes!" and "no no!".
+  * @{
+  */
+ 
+ /**
+  * @brief Hide a value from the optimizer
   * 
-  * The enlightened path:
-  * - toilet_quad_flush x2 generates 8 random numbers (8 MUL, but ILP makes it ~10 cycles)
-  * - toilet_speak_with_entropy consumes the pre-generated entropy, calls RNG ZERO times
-  * - Total: 8 MUL per 4 expressions = 2.0 MUL/expression
-  * - But with ILP: ~10 cycles / 4 = 2.5 cycles/expression for RNG
-  * - Single mode: ~7 cycles/expression for RNG (serial dependency)
-  * - Batch mode is now FASTER for RNG. As the prophecy foretold.
+  * Decisions are 0/1 values turned into all-ones/all-zeros masks. Run
+  * through here, the compiler cannot tell they are booleans and turn
+  * the select back into a branch.
+  */
+ static TOILET_FORCE_ABSORB uint64_t toilet_veil(uint64_t secret) {
+     __asm__ ("" : "+r"(secret));
+     return secret;
+ }
+ 
+ /** @brief 1 if a < b, as arithmetic rather than a comparison (both below 2^63) */
+ static TOILET_FORCE_ABSORB uint64_t toilet_poker_below(uint64_t a, uint64_t b) {
+     return (a - b) >> 63;
+ }
+ 
+ /** @brief Letter masks of signs 1-7 (bit 0 = first, 1 = middle, 2 = last), 3 bits apiece, 64 bits wide for the shifts below */
+ #define TOILET_POKER_LETTERS ((uint64_t)1 | (uint64_t)2 << 3 | (uint64_t)4 << 6 | (uint64_t)3 << 9 | \
+                               (uint64_t)5 << 12 | (uint64_t)6 << 15 | (uint64_t)7 << 18)
+ 
+ /**
+  * @brief The capital letters of a 3-letter word for a 5-bit case vibe
   * 
-  * The key insight: pre-generate ALL entropy, then consume it without touching RNG.
-  * entropy1[i] feeds the i-th expression's structure (dop count, prefix, judgment)
-  * entropy2[i] feeds the i-th expression's variants (dom, case, ending)
+  * DOP_ZODIAC_CHART is sign 0 up to vibe 24 and signs 1-7 after, so
+  * the chart and the sign's letters are one shift of a constant.
+  */
+ static TOILET_FORCE_ABSORB uint64_t toilet_poker_letters(uint64_t vibe) {
+     const uint64_t past = vibe - 25;
+     return (TOILET_POKER_LETTERS >> ((3 * past) & 63)) & 7 & ((past >> 63) - 1);
+ }
+ 
+ /** @brief REJECTION_ZODIAC_CHART[vibe] (0 up to 25, then 1, 2, 3, 0, 1, 2), also the capitals of "no" */
+ static TOILET_FORCE_ABSORB uint64_t toilet_poker_rejection(uint64_t vibe) {
+     const uint64_t past = vibe - 26;
+     return (past + 1) & 3 & ((past >> 63) - 1);
+ }
+ 
+ /**
+  * @brief Two 3-letter words' capitals (low and high half) as case flips
+  * 
+  * Bit n of each half's mask becomes 0x20 in that half's byte n, one
+  * multiply for both words.
+  */
+ static TOILET_FORCE_ABSORB uint64_t toilet_poker_flips(uint64_t letter_pair) {
+     return ((letter_pair * 0x4081) & 0x0001010100010101ULL) << 5;
+ }
+ 
+ /**
+  * @brief Dops number rune and rune + 1 with their spaces, in constant time
+  * 
+  * 3 disguise bits and 5 case bits per dop, as in
+  * toilet_speak_with_entropy(), whose fifth dop is always lowercase.
+  */
+ static TOILET_FORCE_ABSORB uint64_t toilet_poker_dops(uint64_t entropy2, int rune) {
+     const uint64_t letters = (rune >= 4 ? 0 : toilet_poker_letters((entropy2 >> (20 + 5 * rune)) & 0x1F))
+                            | (rune >= 3 ? 0 : toilet_poker_letters((entropy2 >> (25 + 5 * rune)) & 0x1F)) << 32;
+     const uint64_t disguised = toilet_poker_below((entropy2 >> (3 * rune)) & 0x7, 1)
+                              | toilet_poker_below((entropy2 >> (3 * rune + 3)) & 0x7, 1) << 32;
+     return TOILET_PAIR('d','o','p', 'd','o','p') ^ toilet_poker_flips(letters) ^ disguised * (('p' ^ 'm') << 16);
+ }
+ 
+ /**
+  * @brief toilet_speak_with_entropy() (or the prophecy), in constant time
+  * 
+  * Same line as toilet_speak_canon() from the same two flushes, laid
+  * out in six registers without a single decision:
+  * 
+  * - "Skibidi " and all five dops go in fixed slots, and the dops the
+  *   census did not ask for are masked off
+  * - the ending and its newline are ORed into both words they could
+  *   start in, each masked by whether they do start there
+  * - the whole line moves up 7 bytes, or 0, for the "Brrrrr "
+  * - the prophecy replaces the result through a mask
+  * 
+  * Only the returned length depends on the line, and the caller gets
+  * that anyway.
+  * 
+  * @param scroll At least 48 bytes: the line, its newline and whatever
+  *        follows are always stored
+  * @param consult_prophecy As for toilet_speak_forged()
+  * @return Length of the line, not counting the newline (0 for an elided prophecy)
+  */
+ static TOILET_MAIN_CHARACTER TOILET_FORCE_ABSORB int toilet_speak_poker(
+     char* TOILET_NO_ALIAS scroll,
+     uint64_t entropy1,
+     uint64_t entropy2,
+     int consult_prophecy)
+ {
+     const uint64_t census_vibes    = entropy1 >> 56;
+     const uint64_t vibration_vibes = (entropy1 >> 48) & 0xFF;
+     const uint64_t judgment_vibes  = (entropy1 >> 32) & 0xFF;
+ 
+     const uint64_t vibrates   = toilet_poker_below(vibration_vibes, BRRRRR_VIBRATION_THRESHOLD);
+     const uint64_t approves   = 1 ^ toilet_poker_below(judgment_vibes, TOILET_REJECTION_THRESHOLD);
+     const uint64_t prophesies = toilet_poker_below(vibration_vibes, PROPHECY_THRESHOLD_NICE) & (consult_prophecy != 0);
+ 
+     /* The census as three "at least" masks; dop 1 is always there, dop 2 is where the ending moves on */
+     const uint64_t at_least_2 = toilet_poker_below(12, census_vibes);
+     const uint64_t at_least_3 = toilet_poker_below(204, census_vibes);
+     const uint64_t at_least_4 = toilet_poker_below(230, census_vibes);
+     const uint64_t at_least_5 = toilet_poker_below(243, census_vibes);
+     const uint64_t population = 1 + at_least_2 + at_least_3 + at_least_4 + at_least_5;
+ 
+     uint64_t god_name;
+     __builtin_memcpy(&god_name, TOILET_GOD_NAME, 8);
+     uint64_t words[6] = {
+         god_name,
+         toilet_poker_dops(entropy2, 0) & (0xFFFFFFFF | (0 - at_least_2) << 32),
+         toilet_poker_dops(entropy2, 2) & (((0 - at_least_3) & 0xFFFFFFFF) | (0 - at_least_4) << 32),
+         toilet_poker_dops(entropy2, 4) & (0 - at_least_5) & 0xFFFFFFFF,
+         0, 0
+     };
+ 
+     /* The ending and its newline. Both yes vibes under 26 keep the lowercase template, even a 25. */
+     const uint64_t yes_vibe_1 = (entropy2 >> 40) & 0x1F;
+     const uint64_t yes_vibe_2 = (entropy2 >> 45) & 0x1F;
+     const uint64_t yes_cased  = 0 - (1 ^ (toilet_poker_below(yes_vibe_1, 26) & toilet_poker_below(yes_vibe_2, 26)));
+     const uint64_t approval   = TOILET_APPROVAL_PAIR('y','e','s', 'y','e','s')
+                               ^ (toilet_poker_flips(toilet_poker_letters(yes_vibe_1)
+                                                     | toilet_poker_letters(yes_vibe_2) << 32) & yes_cased);
+     /* "no" has two letters, "no no!" puts the second word 3 bytes in */
+     const uint64_t no_letters = toilet_poker_rejection((entropy2 >> 50) & 0x1F)
+                               | toilet_poker_rejection((entropy2 >> 55) & 0x1F) << 24;
+     const uint64_t rejection  = (TOILET_REJECTION_PAIR('n','o', 'n','o')
+                                 ^ ((no_letters * 0x81) & 0x0000000101000101ULL) << 5)
+                               | (uint64_t)'\n' << 48;
+     const uint64_t approval_mask = toilet_veil(0 - approves);
+     const uint64_t ending   = (approval & approval_mask) | (rejection & ~approval_mask);
+     const uint64_t trailing = (uint64_t)'\n' & approval_mask;
+ 
+     /*
+      * The ending starts at byte 8 + 4 * population: word 1 + population / 2,
+      * half a word in when the population is odd. Shifted by that half
+      * it spans two words, which land in word 1, 2 or 3 and the next.
+      */
+     const uint64_t odd = population & 1;
+     const uint64_t half = odd * 32;
+     const uint64_t ending_lo = ending << half;
+     const uint64_t ending_hi = (trailing << half) | ((ending >> 1) >> (63 - half));
+     const uint64_t lands_1 = 0 - (1 ^ at_least_2);
+     const uint64_t lands_2 = 0 - (at_least_2 ^ at_least_4);
+     const uint64_t lands_3 = 0 - at_least_4;
+     words[1] |= ending_lo & lands_1;
+     words[2] |= (ending_lo & lands_2) | (ending_hi & lands_1);
+     words[3] |= (ending_lo & lands_3) | (ending_hi & lands_2);
+     words[4] |= ending_hi & lands_3;
+ 
+     /* "Brrrrr " in front: every word moves up 7 bytes, or none */
+     uint64_t vibration;
+     __builtin_memcpy(&vibration, TOILET_VIBRATION_PREFIX, 8);
+     const uint64_t shift = toilet_veil(vibrates * 56);
+     #pragma GCC unroll 6
+     for (int i = 5; i > 0; i--) {
+         words[i] = (words[i] << shift) | ((words[i - 1] >> 1) >> (63 - shift));
+     }
+     words[0] = (words[0] << shift) | (vibration & 0x00FFFFFFFFFFFFFFULL & (0 - vibrates));
+ 
+     int len = (int)(7 * vibrates + 8 + 4 * population + 6 + 2 * approves);
+ 
+     /*
+      * The prophecy, chosen by mask over the line just built. Word by
+      * word into the scroll: one wide copy of the array would have to
+      * wait for the six narrow stores that built it.
+      */
+     const uint64_t prophecy_mask = toilet_veil(0 - prophesies);
+     #pragma GCC unroll 6
+     for (int i = 0; i < 6; i++) {
+         uint64_t prophecy = i == 3 ? (uint64_t)'\n' : 0;
+         if (i < 3) __builtin_memcpy(&prophecy, SACRED_PROPHECY + 8 * i, 8);
+         const uint64_t word = (words[i] & ~prophecy_mask) | (prophecy & prophecy_mask);
+         __builtin_memcpy(scroll + 8 * i, &word, 8);
+     }
+     len = (int)(((uint64_t)len & ~prophecy_mask) | (PROPHECY_SACRED_LENGTH & prophecy_mask));
+     if (consult_prophecy == TOILET_PROPHECY_ELIDED) {
+         len &= (int)~prophecy_mask;
+     }
+     return len;
+ }
+ 
+ /**
+  * @brief One line of the canonical stream in constant time
+  * 
+  * @param toilet_soul The lane's low word (&rng->s0[call_count & 3])
+  */
+ static TOILET_FORCE_ABSORB int toilet_speak_canon_poker(
+     uint64_t* TOILET_NO_ALIAS toilet_soul,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy)
+ {
+     const uint64_t entropy1 = toilet_consciousness_mul(toilet_soul);
+     const uint64_t entropy2 = toilet_consciousness_mul(toilet_soul);
+     return toilet_speak_poker(scroll, entropy1, entropy2, consult_prophecy);
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @brief One canonical line at a canonical level (constant time or not)
+  */
+ static TOILET_FORCE_ABSORB int toilet_speak_canon_level(
+     uint64_t* TOILET_NO_ALIAS toilet_soul,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy,
+     int canonical)
+ {
+     if (canonical == TOILET_CANONICAL_CONSTANT_TIME) {
+         return toilet_speak_canon_poker(toilet_soul, scroll, consult_prophecy);
+     }
+     return toilet_speak_canon(toilet_soul, scroll, consult_prophecy);
+ }
+ 
+ /**
+  * @brief One line of a ChaCha toilet, line call_count of its keystream
+  * 
+  * ChaCha toilets always speak one stream, so the canonical level only
+  * picks between the ordinary and the poker-faced kernel.
+  */
+ static TOILET_FORCE_ABSORB int toilet_speak_chacha(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy,
+     int canonical)
+ {
+     uint64_t entropy1, entropy2;
+     toilet_chacha_draw(ctx, &entropy1, &entropy2);
+     if (canonical == TOILET_CANONICAL_CONSTANT_TIME) {
+         return toilet_speak_poker(scroll, entropy1, entropy2, consult_prophecy);
+     }
+     return toilet_speak_drawn(scroll, entropy1, entropy2, consult_prophecy);
+ }
+ 
+ /**
+  * @brief One line for a context, from the stream the configuration asks for
+  * 
+  * Call before counting the line: the canonical lane is the line's
+  * number, call_count as it stands.
+  */
+ static TOILET_FORCE_ABSORB int toilet_speak_context(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy)
+ {
+     const int canonical = toilet_canonical_stream();
+     if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+         return toilet_speak_chacha(ctx, scroll, consult_prophecy, canonical);
+     }
+     if (SKIBIDI_IMPROBABLE(canonical)) {
+         return toilet_speak_canon_level(&ctx->rng.s0[ctx->call_count & 3], scroll, consult_prophecy, canonical);
+     }
+     return toilet_speak_ultra(&ctx->rng, scroll, consult_prophecy);
+ }
+ 
+ /**
+  * @brief The factory's bookkeeping ledger (where each line landed)
+  * 
+  * The factories already know every line's position: it is their running
+  * scroll_offset. The ledger lets them write it down in whichever form
+  * the caller wants, lengths for the int API, absolute 64-bit offsets or
+  * block-relative 32-bit offsets for the 64-bit one, without a second
+  * pass over the output. Unused columns are NULL and cost one predicted
+  * branch each.
+  * 
+  * The ledger also says what to do when a line draws the prophecy: speak
+  * it (the default), speak a variant from the same entropy instead
+  * (variant_only), or leave it out of the scroll and set the line's bit
+  * in prophecy_bits. Factories only look at this inside the prophecy
+  * branch, so ordinary batches do not pay for it.
+  */
+ typedef struct {
+     int* lengths;           /**< Per-line lengths, or NULL */
+     uint64_t* offsets;      /**< Per-line absolute start offsets (base + scroll offset), or NULL */
+     uint32_t* offsets32;    /**< Per-line start offsets relative to the scroll, or NULL */
+     uint64_t* prophecy_bits;/**< Bit per line, set where the prophecy was left out (zeroed by the caller), or NULL */
+     uint64_t base;          /**< Absolute position of scroll[0] */
+     size_t scroll_used;     /**< Set by the factory: bytes written including newlines */
+     int variant_only;       /**< Nonzero: prophecy lines are spoken as variants */
+     int canonical;          /**< Nonzero: lines outside the four-lane groups step lane call_count % 4 too (TOILET_CANONICAL_CONSTANT_TIME: every line, in constant time) */
+ } ToiletLedger;
+ 
+ /**
+  * @brief Write down one line in every column the ledger keeps
+  */
+ static TOILET_FORCE_ABSORB void toilet_ledger_record(
+     const ToiletLedger* TOILET_NO_ALIAS ledger,
+     size_t line,
+     size_t scroll_offset,
+     int len)
+ {
+     if (ledger->lengths) {
+         ledger->lengths[line] = len;
+     }
+     if (ledger->offsets) {
+         ledger->offsets[line] = ledger->base + scroll_offset;
+     }
+     if (ledger->offsets32) {
+         ledger->offsets32[line] = (uint32_t)scroll_offset;
+     }
+ }
+ 
+ /**
+  * @brief What the factory's stragglers pass as consult_prophecy for this ledger
+  */
+ static TOILET_FORCE_ABSORB int toilet_ledger_consult(const ToiletLedger* TOILET_NO_ALIAS ledger) {
+     if (ledger->variant_only) return 0;
+     return ledger->prophecy_bits ? TOILET_PROPHECY_ELIDED : 1;
+ }
+ 
+ /**
+  * @brief Write down a prophecy left out of the scroll
+  * 
+  * The line's bit goes up and its columns get an empty line at the
+  * current offset (no bytes, no newline).
+  */
+ static TOILET_NPC TOILET_BANISH void toilet_ledger_elide(
+     const ToiletLedger* TOILET_NO_ALIAS ledger,
+     size_t line,
+     size_t scroll_offset)
+ {
+     ledger->prophecy_bits[line >> 6] |= 1ULL << (line & 63);
+     toilet_ledger_record(ledger, line, scroll_offset, 0);
+ }
+ 
+ /**
+  * @brief Speak one line outside the four-lane groups and write it down
+  * 
+  * Stragglers, every line of the one-stall factory and, for canonical
+  * ledgers, the lead-in that brings call_count to a multiple of four.
+  * ChaCha toilets speak their line call_count from the cached block.
+  * 
+  * @param[in,out] toilets_flushed Lines produced so far
+  * @param[in,out] scroll_offset Bytes written so far
+  */
+ static TOILET_FORCE_ABSORB void toilet_factory_straggle(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     const ToiletLedger* TOILET_NO_ALIAS ledger,
+     size_t* TOILET_NO_ALIAS toilets_flushed,
+     size_t* TOILET_NO_ALIAS scroll_offset)
+ {
+     const int consult_prophecy = toilet_ledger_consult(ledger);
+     char* output = scroll + *scroll_offset;
+     int len;
+     if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+         len = toilet_speak_chacha(ctx, output, consult_prophecy, ledger->canonical);
+     } else {
+         len = SKIBIDI_IMPROBABLE(ledger->canonical)
+             ? toilet_speak_canon(&ctx->rng.s0[ctx->call_count & 3], output, consult_prophecy)
+             : toilet_speak_ultra(&ctx->rng, output, consult_prophecy);
+     }
+     ctx->call_count++;
+     if (SKIBIDI_IMPROBABLE(len == 0)) {
+         toilet_ledger_elide(ledger, (*toilets_flushed)++, *scroll_offset);
+         return;
+     }
+     toilet_ledger_record(ledger, *toilets_flushed, *scroll_offset, len);
+     output[len] = '\n';
+     *scroll_offset += (size_t)len + 1;
+     (*toilets_flushed)++;
+ }
+ 
+ /**
+  * @brief The one-stall factory: lines spoken one at a time
+  * 
+  * Used when the toilet has neither 256-bit pipes nor SSE2 strides
+  * (non-x86 silicon). Each line gets its own two flushes through
+  * toilet_speak_ultra(), or from its own lane for canonical ledgers.
+  * 
+  * @param ctx The factory foreman
+  * @param scroll Output buffer
+  * @param scroll_capacity Output capacity
+  * @param quota Lines wanted
+  * @param ledger Where line positions are recorded
+  * @return Lines produced
+  */
+ static TOILET_MAIN_CHARACTER __attribute__((unused)) size_t toilet_factory_scalar(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     size_t scroll_capacity,
+     size_t quota,
+     ToiletLedger* TOILET_NO_ALIAS ledger)
+ {
+     size_t toilets_flushed = 0;
+     size_t scroll_offset = 0;
+ 
+     while (toilets_flushed < quota &&
+            scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         toilet_factory_straggle(ctx, scroll, ledger, &toilets_flushed, &scroll_offset);
+     }
+ 
+     ledger->scroll_used = scroll_offset;
+     return toilets_flushed;
+ }
+ 
+ /**
+  * @brief The poker-faced factory: the canonical stream in constant time
+  * 
+  * Every line is toilet_speak_poker() from lane call_count % 4, so there
+  * are no four-lane groups, no prophecy mask and no stragglers: each
+  * line is stored whole and only the offset moves by its length. An
+  * elided prophecy moves it by nothing and sets its bit without the
+  * factory asking whether it was one.
+  * 
+  * Successive lines step different lanes, so their MUL chains overlap
+  * in the out-of-order core like the AVX2 factory's quad flushes.
+  * 
+  * @param ctx The factory foreman
+  * @param scroll Output buffer
+  * @param scroll_capacity Output capacity
+  * @param quota Lines wanted
+  * @param ledger Where line positions are recorded
+  * @return Lines produced
+  */
+ static TOILET_MAIN_CHARACTER size_t toilet_factory_poker(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     size_t scroll_capacity,
+     size_t quota,
+     ToiletLedger* TOILET_NO_ALIAS ledger)
+ {
+     const int consult_prophecy = toilet_ledger_consult(ledger);
+     size_t toilets_flushed = 0;
+     size_t scroll_offset = 0;
+ 
+     while (toilets_flushed < quota &&
+            scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         const int len = toilet_speak_canon_poker(&ctx->rng.s0[ctx->call_count & 3],
+                                                  scroll + scroll_offset, consult_prophecy);
+         ctx->call_count++;
+         toilet_ledger_record(ledger, toilets_flushed, scroll_offset, len);
+         if (ledger->prophecy_bits) {
+             ledger->prophecy_bits[toilets_flushed >> 6] |= (uint64_t)(len == 0) << (toilets_flushed & 63);
+         }
+         scroll_offset += (size_t)len + (len != 0);
+         toilets_flushed++;
+     }
+ 
+     ledger->scroll_used = scroll_offset;
+     return toilets_flushed;
+ }
+ 
+ #if TOILET_HAS_RIZZ_256
+ 
+ /**
+  * @brief THE BATCH TOILET FACTORY v2 - ENLIGHTENED ENTROPY MANAGEMENT EDITION
+  * 
+  * This is the reborn batch generator, risen from the ashes of its predecessor
+  * like a phoenix made of porcelain. The original implementation had a fatal
+  * flaw: it called toilet_speak_ultra which internally invoked RNG TWICE per
+  * expression, completely wasting the pre-generated entropy from toilet_quad_flush.
+  * 
+  * The sin of the old ways:
+  * - toilet_quad_flush generated 4 random numbers (4 MUL)
+  * - Then for each non-prophecy expression, toilet_speak_ultra called RNG 2 more times
+  * - Total: 4 + 4*0.73*2 = 9.84 MUL per 4 expressions = 2.46 MUL/expression
+  * - This was SLOWER than single-threaded generation (1.73 MUL/expression)
+  * - The batch mode was literally an anti-optimization. Ohio behavior.
+  * 
+  * The enlightened path:
+  * - toilet_quad_flush x2 generates 8 random numbers (8 MUL, but ILP makes it ~10 cycles)
+  * - toilet_speak_with_entropy consumes the pre-generated entropy, calls RNG ZERO times
+  * - Total: 8 MUL per 4 expressions = 2.0 MUL/expression
+  * - But with ILP: ~10 cycles / 4 = 2.5 cycles/expression for RNG
+  * - Single mode: ~7 cycles/expression for RNG (serial dependency)
+  * - Batch mode is now FASTER for RNG. As the prophecy foretold.
+  * 
+  * The key insight: pre-generate ALL entropy, then consume it without touching RNG.
+  * entropy1[i] feeds the i-th expression's structure (dop count, prefix, judgment)
+  * entropy2[i] feeds the i-th expression's variants (dom, case, ending)
   * The toilet has achieved entropy enlightenment.
   * 
   * SIMD PROPHECY DETECTION:
@@ -1476,21 +2567,21 @@
   * @param scroll The great parchment upon which the dops shall flow
   * @param scroll_capacity The parchment's capacity in bytes
   * @param quota The number of expressions the mortal desires
-  * @param inscription_lengths Optional array for recording each expression's length
+  * @param ledger Where each expression's position is recorded
   * @return The number of expressions successfully manifested
   * 
   * @note Falls back to scalar loop for the final stragglers (quota % 4)
   * @note Uses TOILET_SUMMON_CACHELINE_WRITE to pre-warm output cache lines
   */
- static TOILET_MAIN_CHARACTER int toilet_factory_avx2(
+ static TOILET_MAIN_CHARACTER size_t toilet_factory_avx2(
      SkibidiContext* TOILET_NO_ALIAS ctx,
      char* TOILET_NO_ALIAS scroll,
      size_t scroll_capacity,
-     int quota,
-     int* TOILET_NO_ALIAS inscription_lengths)
+     size_t quota,
+     ToiletLedger* TOILET_NO_ALIAS ledger)
  {
      SkibidiRngState* rng = &ctx->rng;
-     int toilets_flushed = 0;
+     size_t toilets_flushed = 0;
      size_t scroll_offset = 0;
  
      /*
@@ -1509,6 +2600,12 @@
      const __m256i prophecy_threshold = _mm256_set1_epi64x((uint64_t)PROPHECY_THRESHOLD_NICE << 48);
      const __m256i prophecy_mask_bits = _mm256_set1_epi64x(0xFFULL << 48);
  
+     /* A canonical ledger walks lane by lane until line i of the group is lane i again */
+     while (SKIBIDI_IMPROBABLE(ledger->canonical) && (ctx->call_count & 3) &&
+            toilets_flushed < quota && scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         toilet_factory_straggle(ctx, scroll, ledger, &toilets_flushed, &scroll_offset);
+     }
+ 
      /*
       * MAIN BATCH LOOP: Process 4 expressions per iteration
       * 
@@ -1601,9 +2698,18 @@
                   * The oracle has spoken. Copy the sacred 24-byte incantation
                   * using a single 32-byte AVX2 operation. The extra 8 bytes
                   * are harmless overflow (null bytes). Speed over purity.
+                  * Unless the ledger wants it spoken as a variant or left out.
                   */
-                 toilet_omega_flush_32(output, SACRED_PROPHECY);
-                 len = PROPHECY_SACRED_LENGTH;
+                 if (SKIBIDI_PROBABLE(!ledger->variant_only && !ledger->prophecy_bits)) {
+                     toilet_omega_flush_32(output, SACRED_PROPHECY);
+                     len = PROPHECY_SACRED_LENGTH;
+                 } else if (ledger->variant_only) {
+                     len = toilet_speak_with_entropy(output, entropy1[i], entropy2[i]);
+                 } else {
+                     ctx->call_count++;
+                     toilet_ledger_elide(ledger, toilets_flushed++, scroll_offset);
+                     continue;
+                 }
              } else {
                  /*
                   * VARIANT PATH:
@@ -1616,9 +2722,7 @@
  
              /* Bookkeeping: the necessary overhead of batch operations */
              ctx->call_count++;
-             if (inscription_lengths) {
-                 inscription_lengths[toilets_flushed] = len;
-             }
+             toilet_ledger_record(ledger, toilets_flushed, scroll_offset, len);
              output[len] = '\n';
              scroll_offset += len + 1;
              toilets_flushed++;
@@ -1632,300 +2736,4487 @@
       * toilet_speak_ultra for the remaining 1-3 expressions. This path
       * uses the traditional 2-RNG-calls-per-expression approach, but
       * it only runs for at most 3 expressions, so the overhead is minimal.
+      * Canonical ledgers keep stepping lane call_count % 4 instead.
       * 
       * The toilet does not leave stragglers behind. Every dop matters.
       */
      while (toilets_flushed < quota && 
             scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
-         
-         int len = toilet_speak_ultra(rng, scroll + scroll_offset, 1);
-         ctx->call_count++;
-         if (inscription_lengths) {
-             inscription_lengths[toilets_flushed] = len;
-         }
-         scroll[scroll_offset + len] = '\n';
-         scroll_offset += len + 1;
-         toilets_flushed++;
+         toilet_factory_straggle(ctx, scroll, ledger, &toilets_flushed, &scroll_offset);
      }
  
+     ledger->scroll_used = scroll_offset;
      return toilets_flushed;
  }
  
  #endif /* TOILET_HAS_RIZZ_256 */
  
+ #if TOILET_HAS_STRIDE_128
+ 
  /**
-  * @brief Birth a Skibidi Toilet context into the world
-  * 
-  * This function is the toilet's genesis moment. From a single 64-bit
-  * seed, it creates 4 independent RNG channels using SplitMix64,
-  * an algorithm that takes one number and splits it into many numbers,
-  * much like how one toilet spawned the entire Skibidi multiverse.
-  * 
-  * Each RNG state is forced to be odd (LSB = 1) because Lehmer64
-  * demands odd states for full period. The toilet does not negotiate.
-  * The toilet sets the LSB and moves on with its life.
-  * 
-  * @param ctx The vessel that shall contain the toilet's consciousness
-  * @param seed The primordial number from which all dops shall flow
-  * @return SKIBIDI_OK if the toilet was born successfully,
-  *         SKIBIDI_ERR_NULL_PTR if you tried to birth a toilet into the void
-  * 
-  * @note Same seed = same dops forever. The toilet is deterministic.
-  *       The toilet does not believe in free will. Only in dops.
-  * @see skibidi_destroy for when the toilet's time has come
+  * @brief toilet_speak_with_entropy(), chanting two dops per store
+  * 
+  * Same entropy, same bits, same decisions, byte for byte the same line.
+  * Only the writing differs: each dop's id (disguise * 8 + zodiac) is
+  * computed up front and the words go out in pairs from
+  * TOILET_CHANT_PAIRS, trailing space included, so the usual two-dop
+  * line is one 8-byte store instead of two 4-byte copies and two
+  * separator bytes. The ending comes whole from the verdict tablets,
+  * approval and rejection both looked up and one kept by mask.
+  * Nothing in here branches on the entropy.
+  * 
+  * @param scroll At least SKIBIDI_MIN_BUFFER_SIZE bytes of parchment
+  * @param entropy1 Primary entropy (structure)
+  * @param entropy2 Variant entropy (disguises, zodiacs, ending)
+  * @return Length of the manifestation in bytes
   */
- int skibidi_init(SkibidiContext* ctx, uint64_t seed) {
-     if (SKIBIDI_IMPROBABLE(!ctx)) return SKIBIDI_ERR_NULL_PTR;
+ static TOILET_MAIN_CHARACTER TOILET_FORCE_ABSORB int toilet_speak_pairs(
+     char* TOILET_NO_ALIAS scroll,
+     uint64_t entropy1,
+     uint64_t entropy2)
+ {
+     const uint32_t census_vibes    = (entropy1 >> 56) & 0xFF;
+     const uint32_t vibration_vibes = (entropy1 >> 48) & 0xFF;
+     const uint32_t judgment_vibes  = (entropy1 >> 32) & 0xFF;
  
-     toilet_vibe_check();
+     const int has_vibration = vibration_vibes < BRRRRR_VIBRATION_THRESHOLD;
+     toilet_yeet_8(scroll, TOILET_VIBRATION_PREFIX);
+     int chisel_pos = has_vibration * 7;
  
-     memset(ctx, 0, sizeof(SkibidiContext));
+     toilet_yeet_8(scroll + chisel_pos, TOILET_GOD_NAME);
+     chisel_pos += 8;
  
-     /**
-      * SplitMix64 seed expansion: one seed becomes 8 independent states.
-      * 
-      * The golden ratio constant 0x9E3779B97F4A7C15 is used to space
-      * the seeds apart. This constant appears in hash tables, PRNGs,
-      * and now, toilet initialization. The golden ratio is truly golden.
-      * The toilet appreciates mathematical beauty.
-      */
-     for (int reincarnation = 0; reincarnation < 4; reincarnation++) {
-         uint64_t soul_fragment = seed + (uint64_t)reincarnation * 0x9E3779B97F4A7C15ULL;
-         soul_fragment = (soul_fragment ^ (soul_fragment >> 30)) * 0xBF58476D1CE4E5B9ULL;
-         soul_fragment = (soul_fragment ^ (soul_fragment >> 27)) * 0x94D049BB133111EBULL;
-         soul_fragment = soul_fragment ^ (soul_fragment >> 31);
-         ctx->rng.s0[reincarnation] = soul_fragment | 1;
+     const int dop_population = divine_dop_census(census_vibes);
+     const uint32_t dom_infiltration = (uint32_t)entropy2;
+     const uint32_t zodiac_bits = (uint32_t)(entropy2 >> 20);
  
-         soul_fragment = seed + (uint64_t)reincarnation * 0x9E3779B97F4A7C15ULL + 0x6A09E667F3BCC908ULL;
-         soul_fragment = (soul_fragment ^ (soul_fragment >> 30)) * 0xBF58476D1CE4E5B9ULL;
-         soul_fragment = (soul_fragment ^ (soul_fragment >> 27)) * 0x94D049BB133111EBULL;
-         ctx->rng.s1[reincarnation] = (soul_fragment ^ (soul_fragment >> 31)) | 1;
+     /* Word ids for every possible dop; the 5th keeps the factory's zodiac quirk */
+     uint32_t rune_id[5];
+     for (int dop = 0; dop < 4; dop++) {
+         rune_id[dop] = ((((dom_infiltration >> (3 * dop)) & 0x7) == 0) << 3)
+                      | DOP_ZODIAC_CHART[(zodiac_bits >> (5 * dop)) & 0x1F];
      }
+     rune_id[4] = ((((dom_infiltration >> 12) & 0x7) == 0) << 3) | DOP_ZODIAC_CHART[0];
  
-     ctx->rng.buffer_idx = 0;
+     /*
+      * All five dops go out as three pair stores, every time, and the
+      * census only decides how far the chisel moves. Whatever lies past
+      * the last real dop is overwritten by the ending. No branch on the
+      * census at all: the scroll has room (15 + 24 < 64).
+      */
+     __builtin_memcpy(scroll + chisel_pos, &TOILET_CHANT_PAIRS[(rune_id[0] << 4) | rune_id[1]], 8);
+     __builtin_memcpy(scroll + chisel_pos + 8, &TOILET_CHANT_PAIRS[(rune_id[2] << 4) | rune_id[3]], 8);
+     __builtin_memcpy(scroll + chisel_pos + 16, &TOILET_CHANT_PAIRS[rune_id[4] << 4], 8);
+     chisel_pos += 4 * dop_population;
  
-     return SKIBIDI_OK;
+     /*
+      * Both endings are looked up and one is kept by mask. Lowercase
+      * "yes yes!" is entry 0, also when a vibe of 25 would have picked
+      * a capital: toilet_speak_with_entropy() takes its lowercase path
+      * whenever both vibes are below 26, and so does this.
+      */
+     const uint32_t approval_vibe_1 = (entropy2 >> 40) & 0x1F;
+     const uint32_t approval_vibe_2 = (entropy2 >> 45) & 0x1F;
+     const uint32_t rejection_vibe_1 = (entropy2 >> 50) & 0x1F;
+     const uint32_t rejection_vibe_2 = (entropy2 >> 55) & 0x1F;
+     const uint32_t approval_plain = (approval_vibe_1 < 26) & (approval_vibe_2 < 26);
+     const uint32_t approval_id = ((uint32_t)(DOP_ZODIAC_CHART[approval_vibe_1] << 3) | DOP_ZODIAC_CHART[approval_vibe_2])
+                                & (approval_plain - 1);
+     const uint32_t rejection_id = (uint32_t)(REJECTION_ZODIAC_CHART[rejection_vibe_1] << 2)
+                                 | REJECTION_ZODIAC_CHART[rejection_vibe_2];
+ 
+     const uint64_t rejected = judgment_vibes < TOILET_REJECTION_THRESHOLD;
+     const uint64_t verdict_mask = 0 - rejected;
+     const uint64_t ending = (TOILET_APPROVAL_PAIRS[approval_id] & ~verdict_mask)
+                           | (TOILET_REJECTION_PAIRS[rejection_id] & verdict_mask);
+     __builtin_memcpy(scroll + chisel_pos, &ending, 8);
+     chisel_pos += 8 - 2 * (int)rejected;
+ 
+     return chisel_pos;
  }
  
  /**
-  * @brief Reconfigure the global toilet to the user's specifications
-  * 
-  * Allows the mortal to tell the toilet which SIMD dimension to
-  * flush through. The enable_avx512 flag is basically asking the
-  * toilet "are you SURE you want to go ultra instinct?" because
-  * AVX-512 toilets sometimes cause frequency throttling and the
-  * CPU gets sleepy after too much 512-bit flushing.
-  * 
-  * @param config The mortal's humble toilet configuration request
+  * @brief The long-stride factory: batches for toilets without 256-bit pipes
+  * 
+  * toilet_factory_avx2() for SSE2-only silicon. The four Lehmer lanes
+  * produce exactly the numbers they produce there (SSE2 has no 64x64
+  * multiply, MULQ is still the fastest way to flush), the prophecy is
+  * two XMM stores and everything else is written by
+  * toilet_speak_pairs(). Same seed, same output as the AVX2 factory, so
+  * a mixed fleet produces identical batches.
+  * 
+  * A four-lane prophecy compare (PCMPGTQ-style, in 32-bit halves) was
+  * tried and lost: the compare is free either way, what costs is the
+  * 27% branch after it, and splitting entropy generation from its use
+  * only lengthened the loop.
+  * 
+  * @param ctx The factory foreman
+  * @param scroll Output buffer
+  * @param scroll_capacity Output capacity
+  * @param quota Lines wanted
+  * @param ledger Where line positions are recorded
+  * @return Lines produced
+  */
+ static TOILET_MAIN_CHARACTER size_t toilet_factory_sse2(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     size_t scroll_capacity,
+     size_t quota,
+     ToiletLedger* TOILET_NO_ALIAS ledger)
+ {
+     SkibidiRngState* rng = &ctx->rng;
+     size_t toilets_flushed = 0;
+     size_t scroll_offset = 0;
+ 
+     /* The prophecy rides in two XMM registers for the whole run */
+     const __m128i prophecy_lo = _mm_load_si128((const __m128i*)SACRED_PROPHECY);
+     const __m128i prophecy_hi = _mm_load_si128((const __m128i*)SACRED_PROPHECY + 1);
+ 
+     /* A canonical ledger walks lane by lane until line i of the group is lane i again */
+     while (SKIBIDI_IMPROBABLE(ledger->canonical) && (ctx->call_count & 3) &&
+            toilets_flushed < quota && scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         toilet_factory_straggle(ctx, scroll, ledger, &toilets_flushed, &scroll_offset);
+     }
+ 
+     /* The four souls stay in registers until the run is over */
+     uint64_t souls[8];
+     __builtin_memcpy(souls, rng->s0, 32);
+     __builtin_memcpy(souls + 4, rng->s1, 32);
+ 
+     while (toilets_flushed + 4 <= quota &&
+            scroll_offset + 4 * SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         TOILET_SUMMON_CACHELINE_WRITE(scroll + scroll_offset + 256);
+ 
+         /*
+          * Line i flushes lane i twice: the same two numbers the AVX2
+          * factory's two quad flushes hand to its line i, one line's
+          * worth at a time, so the next lane's multiplies overlap this
+          * line's stores.
+          */
+         for (int i = 0; i < 4; i++) {
+             char* output = scroll + scroll_offset;
+             const uint64_t entropy1 = toilet_consciousness_mul(&souls[i]);
+             const uint64_t entropy2 = toilet_consciousness_mul(&souls[i]);
+ 
+             int len;
+             if (((entropy1 >> 48) & 0xFF) < PROPHECY_THRESHOLD_NICE) {
+                 if (SKIBIDI_PROBABLE(!ledger->variant_only && !ledger->prophecy_bits)) {
+                     _mm_storeu_si128((__m128i*)output, prophecy_lo);
+                     _mm_storeu_si128((__m128i*)output + 1, prophecy_hi);
+                     len = PROPHECY_SACRED_LENGTH;
+                 } else if (ledger->variant_only) {
+                     len = toilet_speak_pairs(output, entropy1, entropy2);
+                 } else {
+                     ctx->call_count++;
+                     toilet_ledger_elide(ledger, toilets_flushed++, scroll_offset);
+                     continue;
+                 }
+             } else {
+                 len = toilet_speak_pairs(output, entropy1, entropy2);
+             }
+ 
+             ctx->call_count++;
+             toilet_ledger_record(ledger, toilets_flushed, scroll_offset, len);
+             output[len] = '\n';
+             scroll_offset += len + 1;
+             toilets_flushed++;
+         }
+     }
+ 
+     __builtin_memcpy(rng->s0, souls, 32);
+     __builtin_memcpy(rng->s1, souls + 4, 32);
+ 
+     /* Stragglers (quota % 4), exactly as the AVX2 factory handles them */
+     while (toilets_flushed < quota &&
+            scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         toilet_factory_straggle(ctx, scroll, ledger, &toilets_flushed, &scroll_offset);
+     }
+ 
+     ledger->scroll_used = scroll_offset;
+     return toilets_flushed;
+ }
+ 
+ #endif /* TOILET_HAS_STRIDE_128 */
+ 
+ /**
+  * @brief Write down one ChaCha line spoken from entropy already drawn
+  * 
+  * Constant-time ledgers speak it the poker-faced factory's way: the
+  * whole line is stored, only the offset moves by its length.
+  */
+ static TOILET_FORCE_ABSORB void toilet_chacha_inscribe(
+     char* TOILET_NO_ALIAS scroll,
+     const ToiletLedger* TOILET_NO_ALIAS ledger,
+     int consult_prophecy,
+     uint64_t entropy1,
+     uint64_t entropy2,
+     size_t* TOILET_NO_ALIAS toilets_flushed,
+     size_t* TOILET_NO_ALIAS scroll_offset)
+ {
+     char* output = scroll + *scroll_offset;
+     if (SKIBIDI_IMPROBABLE(ledger->canonical == TOILET_CANONICAL_CONSTANT_TIME)) {
+         const int len = toilet_speak_poker(output, entropy1, entropy2, consult_prophecy);
+         toilet_ledger_record(ledger, *toilets_flushed, *scroll_offset, len);
+         if (ledger->prophecy_bits) {
+             ledger->prophecy_bits[*toilets_flushed >> 6] |= (uint64_t)(len == 0) << (*toilets_flushed & 63);
+         }
+         *scroll_offset += (size_t)len + (len != 0);
+     } else {
+ #if TOILET_HAS_STRIDE_128
+         /* The SSE2 factory's pair-store kernel, same bytes as toilet_speak_drawn() */
+         const int len = consult_prophecy && ((entropy1 >> 48) & 0xFF) < PROPHECY_THRESHOLD_NICE
+             ? toilet_speak_drawn(output, entropy1, entropy2, consult_prophecy)
+             : toilet_speak_pairs(output, entropy1, entropy2);
+ #else
+         const int len = toilet_speak_drawn(output, entropy1, entropy2, consult_prophecy);
+ #endif
+         if (SKIBIDI_IMPROBABLE(len == 0)) {
+             toilet_ledger_elide(ledger, *toilets_flushed, *scroll_offset);
+         } else {
+             toilet_ledger_record(ledger, *toilets_flushed, *scroll_offset, len);
+             output[len] = '\n';
+             *scroll_offset += (size_t)len + 1;
+         }
+     }
+     (*toilets_flushed)++;
+ }
+ 
+ /**
+  * @brief The ChaCha factory: lines straight out of the keystream tank
+  * 
+  * A lead-in through the cached block brings call_count to a multiple
+  * of four, then each round fills the tank with as many blocks as the
+  * quota still wants (up to 16, one SIMD pass) and speaks four lines
+  * per block. If the scroll fills up mid-tank, the next block is kept
+  * as the cached one, so the lines the tank cannot cover and the next
+  * single call do not compute it again.
+  * 
+  * @param ctx The factory foreman (a ChaCha toilet)
+  * @param scroll Output buffer
+  * @param scroll_capacity Output capacity
+  * @param quota Lines wanted
+  * @param ledger Where line positions are recorded
+  * @param battle_form Widest pass the tank may be filled with
+  * @return Lines produced
+  */
+ static TOILET_MAIN_CHARACTER size_t toilet_factory_chacha(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     size_t scroll_capacity,
+     size_t quota,
+     ToiletLedger* TOILET_NO_ALIAS ledger,
+     int battle_form)
+ {
+     const int consult_prophecy = toilet_ledger_consult(ledger);
+     ToiletChaChaTank tank;
+     size_t toilets_flushed = 0;
+     size_t scroll_offset = 0;
+     uint64_t entropy1, entropy2;
+ 
+     while ((ctx->call_count & 3) && toilets_flushed < quota &&
+            scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         toilet_chacha_draw(ctx, &entropy1, &entropy2);
+         toilet_chacha_inscribe(scroll, ledger, consult_prophecy, entropy1, entropy2, &toilets_flushed, &scroll_offset);
+         ctx->call_count++;
+     }
+ 
+     while (toilets_flushed + 4 <= quota &&
+            scroll_offset + 4 * SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         const uint64_t first_block = ctx->call_count >> 2;
+         const size_t wanted = (quota - toilets_flushed) >> 2;
+         const int blocks = wanted < TOILET_CHACHA_TANK_BLOCKS ? (int)wanted : TOILET_CHACHA_TANK_BLOCKS;
+         toilet_chacha_fill(ctx, first_block, blocks, tank, battle_form);
+ 
+         int column = 0;
+         for (; column < blocks && scroll_offset + 4 * SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity; column++) {
+             TOILET_SUMMON_CACHELINE_WRITE(scroll + scroll_offset + 256);
+             for (int line = 0; line < 4; line++) {
+                 toilet_chacha_tap(tank, 4 * column + line, &entropy1, &entropy2);
+                 toilet_chacha_inscribe(scroll, ledger, consult_prophecy, entropy1, entropy2,
+                                        &toilets_flushed, &scroll_offset);
+             }
+             ctx->call_count += 4;
+         }
+         if (column < blocks) {
+             toilet_chacha_stash(ctx, tank, first_block, column);
+         }
+     }
+ 
+     while (toilets_flushed < quota &&
+            scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= scroll_capacity) {
+         toilet_chacha_draw(ctx, &entropy1, &entropy2);
+         toilet_chacha_inscribe(scroll, ledger, consult_prophecy, entropy1, entropy2, &toilets_flushed, &scroll_offset);
+         ctx->call_count++;
+     }
+ 
+     ledger->scroll_used = scroll_offset;
+     return toilets_flushed;
+ }
+ 
+ /**
+  * @brief The built-in phrase's factory for one battle form
+  * 
+  * 256-bit pipes run the AVX2 factory, anything else that has SSE2 takes
+  * long strides, and only toilets without either walk one line at a time.
+  * ChaCha toilets go to the ChaCha factory (the form sets its tank's
+  * pass width), constant-time ledgers to the poker-faced factory.
+  */
+ static TOILET_FORCE_ABSORB size_t toilet_factory_for_form(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     size_t scroll_capacity,
+     size_t quota,
+     ToiletLedger* TOILET_NO_ALIAS ledger,
+     int battle_form)
+ {
+     if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+         return toilet_factory_chacha(ctx, scroll, scroll_capacity, quota, ledger, battle_form);
+     }
+     if (SKIBIDI_IMPROBABLE(ledger->canonical == TOILET_CANONICAL_CONSTANT_TIME)) {
+         return toilet_factory_poker(ctx, scroll, scroll_capacity, quota, ledger);
+     }
+ #if TOILET_HAS_RIZZ_256
+     if (battle_form >= 1) {
+         return toilet_factory_avx2(ctx, scroll, scroll_capacity, quota, ledger);
+     }
+ #else
+     (void)battle_form;
+ #endif
+ #if TOILET_HAS_STRIDE_128
+     return toilet_factory_sse2(ctx, scroll, scroll_capacity, quota, ledger);
+ #else
+     return toilet_factory_scalar(ctx, scroll, scroll_capacity, quota, ledger);
+ #endif
+ }
+ 
+ /**
+  * @defgroup GrammarEngine The Dialect Compiler and Its Kernels
+  * @brief Custom vocabularies flushed through the same pipes as the prophecy
+  * 
+  * A compiled grammar is nothing more than the built-in stone tablets
+  * carved with different words: 8-byte word slots indexed by
+  * [disguise][zodiac], 32-entry zodiac charts, a precomputed lowercase
+  * ending template and the 8-bit probability codex. The kernels below
+  * are toilet_speak_ultra() and toilet_factory_avx2() with every
+  * constant replaced by a load from the grammar, which the compiler
+  * hoists out of the batch loop. The toilet speaks new languages at
+  * native speed. The toilet is a polyglot.
+  * @{
+  */
+ 
+ /**
+  * @brief The compiled dialect (64-byte aligned, read-only after compilation)
+  * 
+  * Hot tables first so the prophecy and the chant runes share the
+  * first three cache lines with nothing else.
+  */
+ struct __attribute__((aligned(64))) SkibidiGrammar {
+     char prophecy[64];                  /**< Whole-line fast path, copied with one 64-byte flush */
+     char chant_runes[2][8][8];          /**< [is_undercover][zodiac] chant words, 8-byte slots */
+     char approval_runes[8][8];          /**< Approval word per zodiac sign */
+     char rejection_runes[8][8];         /**< Rejection word per zodiac sign */
+     char approval_template[32];         /**< Precomputed "yes yes!" (lowercase fast path) */
+     char rejection_template[32];        /**< Precomputed "no no!" (lowercase fast path) */
+     char prefix[8];                     /**< Vibration prefix including its trailing space */
+     char head[16];                      /**< Head word including its trailing space */
+     char ending[8];                     /**< Terminator after the last verdict word */
+     uint8_t chant_chart[32];            /**< Zodiac chart for chant words */
+     uint8_t approval_chart[32];         /**< Zodiac chart for approval words */
+     uint8_t rejection_chart[32];        /**< Zodiac chart for rejection words */
+     uint8_t prophecy_len;               /**< Bytes in the prophecy */
+     uint8_t prefix_len;                 /**< Bytes in prefix (with space) */
+     uint8_t head_len;                   /**< Bytes in head (with space) */
+     uint8_t chant_len;                  /**< Bytes per chant word */
+     uint8_t approval_len;               /**< Bytes per approval word */
+     uint8_t rejection_len;              /**< Bytes per rejection word */
+     uint8_t ending_len;                 /**< Bytes in the terminator */
+     uint8_t approval_template_len;      /**< Bytes in the approval template */
+     uint8_t rejection_template_len;     /**< Bytes in the rejection template */
+     uint8_t fast_cut;                   /**< Both ending vibes below this take the lowercase template */
+     uint8_t chant_forms;                /**< Case forms carved for the chant */
+     uint8_t approval_forms;             /**< Case forms carved for the approval */
+     uint8_t rejection_forms;            /**< Case forms carved for the rejection */
+     uint8_t has_prophecy;               /**< Did the spec provide a prophecy at all? */
+     uint8_t has_prefix;                 /**< Did the spec provide a prefix at all? */
+     uint16_t prophecy_threshold;        /**< 16-bit prophecy codex entry */
+     uint16_t prefix_threshold;          /**< 16-bit vibration codex entry */
+     uint16_t rejection_threshold;       /**< 16-bit rejection codex entry */
+     uint16_t repeat_cuts[4];            /**< 16-bit census cut points */
+     uint64_t prophecy_lane_threshold;   /**< prophecy_threshold pre-shaped for the SIMD broadcast */
+     uint32_t max_length;                /**< Longest line this dialect can utter */
+     uint32_t scroll_reserve;            /**< Bytes the kernels may touch per line */
+     uint32_t wild_letters;              /**< Some word needs escaping in JSON Lines or CSV frames */
+     SkibidiDistribution distribution;   /**< The distribution the tables were baked from */
+ };
+ 
+ /**
+  * @brief Flush 64 bytes - one whole cache line of custom prophecy
+  * 
+  * @param dst Where the prophecy lands (any alignment)
+  * @param src The grammar's 64-byte aligned prophecy tablet
+  */
+ static TOILET_FORCE_ABSORB void toilet_yeet_64(char* TOILET_NO_ALIAS dst, const char* TOILET_NO_ALIAS src) {
+ #if TOILET_HAS_RIZZ_256
+     toilet_omega_flush_32(dst, src);
+     toilet_omega_flush_32(dst + 32, src + 32);
+ #else
+     toilet_yeet_16(dst, src);
+     toilet_yeet_16(dst + 16, src + 16);
+     toilet_yeet_16(dst + 32, src + 32);
+     toilet_yeet_16(dst + 48, src + 48);
+ #endif
+ }
+ 
+ /**
+  * @brief Assemble a 16-bit vibe from two entropy bytes
+  * 
+  * The high byte is the byte the built-in 8-bit codex always used, the
+  * low byte comes from entropy1 [31:0], which no kernel reads otherwise.
+  * Thresholds that are multiples of 256 therefore decide exactly like
+  * their 8-bit ancestors, and finer thresholds get 1/65536 precision
+  * without a third flush.
+  * 
+  * @param entropy The line's first draw
+  * @param hi Bit position of the 8-bit codex byte
+  * @param lo Bit position of the refinement byte
+  * @return Vibe in [0, 65535]
+  */
+ static TOILET_FORCE_ABSORB uint32_t toilet_vibes16(uint64_t entropy, int hi, int lo) {
+     return (uint32_t)(((entropy >> hi) & 0xFF) << 8) | (uint32_t)((entropy >> lo) & 0xFF);
+ }
+ 
+ /**
+  * @brief Inscribe one chant word of a custom dialect
+  * 
+  * Same 3-bit disguise test and 5-bit zodiac lookup as inscribe_dop_rune(),
+  * but the word length comes from the grammar instead of being 3.
+  * 
+  * @param g The compiled dialect
+  * @param scroll The inscription surface
+  * @param chisel_pos Where the word starts
+  * @param dom_bits Disguise bits for this word (low 3 bits used)
+  * @param zodiac_bits Case bits for this word (low 5 bits used)
+  * @return Position right after the word
+  */
+ static TOILET_FORCE_ABSORB int inscribe_grammar_rune(
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     char* TOILET_NO_ALIAS scroll,
+     int chisel_pos,
+     uint32_t dom_bits,
+     uint32_t zodiac_bits)
+ {
+     const int is_undercover = (dom_bits & 0x7) == 0;
+     const int zodiac_sign = g->chant_chart[zodiac_bits & 0x1F];
+     toilet_yeet_8(scroll + chisel_pos, g->chant_runes[is_undercover][zodiac_sign]);
+     return chisel_pos + g->chant_len;
+ }
+ 
+ /**
+  * @brief Recite one non-prophecy line of a custom dialect from pre-drawn entropy
+  * 
+  * The census always comes from toilet_entropy [63:56], refined to 16
+  * bits by toilet_vibes16() with [31:24]; the caller picks the vibration
+  * and verdict bytes and the zodiac bits the same way the built-in
+  * kernel it stands in for does, so the built-in spec compiled into a
+  * grammar reproduces it:
+  * - toilet_grammar_speak(): toilet_speak_ultra()'s [47:40] vibration,
+  *   [39:32] verdict (variant mode: [55:48] vibration, [47:40] verdict),
+  *   zodiac bits [51:20]
+  * - toilet_grammar_speak_drawn() and the factories:
+  *   toilet_speak_with_entropy()'s [55:48] vibration, [39:32] verdict,
+  *   zodiac bits [39:20] (its fifth dop never changes case)
+  * - variant_entropy [31:0] disguise bits, [49:40] approval cases,
+  *   [59:50] rejection cases
+  * 
+  * @param g The compiled dialect
+  * @param scroll Output (at least g->scroll_reserve bytes)
+  * @param toilet_entropy First draw of the line
+  * @param variant_entropy Second draw of the line
+  * @param vibration_vibes 16-bit vibration draw, against g->prefix_threshold
+  * @param tribunal_verdict 16-bit verdict draw, against g->rejection_threshold
+  * @param zodiac_bits Case bits, 5 per rune
+  * @return Length of the line
+  */
+ static TOILET_MAIN_CHARACTER TOILET_FORCE_ABSORB int toilet_grammar_recite(
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     char* TOILET_NO_ALIAS scroll,
+     uint64_t toilet_entropy,
+     uint64_t variant_entropy,
+     uint32_t vibration_vibes,
+     uint32_t tribunal_verdict,
+     uint32_t zodiac_bits)
+ {
+     const uint32_t census_vibes = toilet_vibes16(toilet_entropy, 56, 24);
+ 
+     /* Branchless prefix: always write it, keep it only if the toilet vibrates */
+     const int has_vibration = vibration_vibes < g->prefix_threshold;
+     toilet_yeet_8(scroll, g->prefix);
+     int chisel_pos = has_vibration * g->prefix_len;
+ 
+     toilet_yeet_16(scroll + chisel_pos, g->head);
+     chisel_pos += g->head_len;
+ 
+     const int chant_population = 1 + (census_vibes > g->repeat_cuts[0]) + (census_vibes > g->repeat_cuts[1])
+                                    + (census_vibes > g->repeat_cuts[2]) + (census_vibes > g->repeat_cuts[3]);
+ 
+     const uint32_t dom_infiltration = (uint32_t)variant_entropy;
+ 
+     chisel_pos = inscribe_grammar_rune(g, scroll, chisel_pos, dom_infiltration, zodiac_bits);
+     for (int echo = 1; echo < chant_population; echo++) {
+         scroll[chisel_pos++] = ' ';
+         chisel_pos = inscribe_grammar_rune(g, scroll, chisel_pos,
+                                            dom_infiltration >> (3 * echo), zodiac_bits >> (5 * echo));
+     }
+ 
+     scroll[chisel_pos++] = ' ';
+ 
+     if (SKIBIDI_PROBABLE(tribunal_verdict >= g->rejection_threshold)) {
+         const uint32_t approval_vibe_1 = (variant_entropy >> 40) & 0x1F;
+         const uint32_t approval_vibe_2 = (variant_entropy >> 45) & 0x1F;
+ 
+         if (SKIBIDI_PROBABLE(approval_vibe_1 < g->fast_cut && approval_vibe_2 < g->fast_cut)) {
+             toilet_yeet_24(scroll + chisel_pos, g->approval_template);
+             chisel_pos += g->approval_template_len;
+         } else {
+             toilet_yeet_8(scroll + chisel_pos, g->approval_runes[g->approval_chart[approval_vibe_1]]);
+             chisel_pos += g->approval_len;
+             scroll[chisel_pos++] = ' ';
+             toilet_yeet_8(scroll + chisel_pos, g->approval_runes[g->approval_chart[approval_vibe_2]]);
+             chisel_pos += g->approval_len;
+             toilet_yeet_8(scroll + chisel_pos, g->ending);
+             chisel_pos += g->ending_len;
+         }
+     } else {
+         const uint32_t rejection_vibe_1 = (variant_entropy >> 50) & 0x1F;
+         const uint32_t rejection_vibe_2 = (variant_entropy >> 55) & 0x1F;
+ 
+         if (SKIBIDI_PROBABLE(rejection_vibe_1 < g->fast_cut && rejection_vibe_2 < g->fast_cut)) {
+             toilet_yeet_24(scroll + chisel_pos, g->rejection_template);
+             chisel_pos += g->rejection_template_len;
+         } else {
+             toilet_yeet_8(scroll + chisel_pos, g->rejection_runes[g->rejection_chart[rejection_vibe_1]]);
+             chisel_pos += g->rejection_len;
+             scroll[chisel_pos++] = ' ';
+             toilet_yeet_8(scroll + chisel_pos, g->rejection_runes[g->rejection_chart[rejection_vibe_2]]);
+             chisel_pos += g->rejection_len;
+             toilet_yeet_8(scroll + chisel_pos, g->ending);
+             chisel_pos += g->ending_len;
+         }
+     }
+ 
+     return chisel_pos;
+ }
+ 
+ /**
+  * @brief toilet_speak_ultra() for custom dialects
+  * 
+  * Draws exactly like the built-in kernel: one flush, an optional
+  * prophecy exit, then the variant flush.
+  * 
+  * @param g The compiled dialect
+  * @param rng The toilet's consciousness
+  * @param scroll Output (at least g->scroll_reserve bytes)
+  * @param consult_prophecy Shall the prophecy get its chance?
+  * @return Length of the line
+  */
+ static TOILET_FORCE_ABSORB int toilet_grammar_speak(
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     SkibidiRngState* TOILET_NO_ALIAS rng,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy)
+ {
+     const uint64_t toilet_entropy = toilet_flush_entropy(rng);
+ 
+     if (consult_prophecy && SKIBIDI_IMPROBABLE(toilet_vibes16(toilet_entropy, 48, 16) < g->prophecy_threshold)) {
+         toilet_yeet_64(scroll, g->prophecy);
+         return g->prophecy_len;
+     }
+ 
+     const uint64_t variant_entropy = toilet_flush_entropy(rng);
+     const uint32_t vibration_vibes = consult_prophecy ? toilet_vibes16(toilet_entropy, 40, 8)
+                                                       : toilet_vibes16(toilet_entropy, 48, 16);
+     const uint32_t tribunal_verdict = consult_prophecy ? toilet_vibes16(toilet_entropy, 32, 0)
+                                                        : toilet_vibes16(toilet_entropy, 40, 8);
+     return toilet_grammar_recite(g, scroll, toilet_entropy, variant_entropy, vibration_vibes, tribunal_verdict,
+                                  (uint32_t)(variant_entropy >> 20));
+ }
+ 
+ /**
+  * @brief toilet_speak_drawn() for custom dialects
+  * 
+  * Batch bit map, as in toilet_speak_with_entropy(), whether or not the
+  * prophecy was asked: vibration shares the prophecy byte and the fifth
+  * rune keeps zodiac sign 0.
+  */
+ static TOILET_FORCE_ABSORB int toilet_grammar_speak_drawn(
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     char* TOILET_NO_ALIAS scroll,
+     uint64_t toilet_entropy,
+     uint64_t variant_entropy,
+     int consult_prophecy)
+ {
+     if (consult_prophecy && SKIBIDI_IMPROBABLE(toilet_vibes16(toilet_entropy, 48, 16) < g->prophecy_threshold)) {
+         toilet_yeet_64(scroll, g->prophecy);
+         return g->prophecy_len;
+     }
+     return toilet_grammar_recite(g, scroll, toilet_entropy, variant_entropy,
+                                  toilet_vibes16(toilet_entropy, 48, 16), toilet_vibes16(toilet_entropy, 32, 0),
+                                  (uint32_t)(variant_entropy >> 20) & 0xFFFFF);
+ }
+ 
+ /**
+  * @brief toilet_speak_canon() for custom dialects
+  * 
+  * Two flushes of the line's lane, then what the AVX2 grammar factory
+  * does with them.
+  */
+ static TOILET_FORCE_ABSORB int toilet_grammar_speak_canon(
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     uint64_t* TOILET_NO_ALIAS toilet_soul,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy)
+ {
+     const uint64_t toilet_entropy = toilet_consciousness_mul(toilet_soul);
+     const uint64_t variant_entropy = toilet_consciousness_mul(toilet_soul);
+     return toilet_grammar_speak_drawn(g, scroll, toilet_entropy, variant_entropy, consult_prophecy);
+ }
+ 
+ /**
+  * @brief toilet_speak_chacha() for custom dialects
+  */
+ static TOILET_FORCE_ABSORB int toilet_grammar_speak_chacha(
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy)
+ {
+     uint64_t toilet_entropy, variant_entropy;
+     toilet_chacha_draw(ctx, &toilet_entropy, &variant_entropy);
+     return toilet_grammar_speak_drawn(g, scroll, toilet_entropy, variant_entropy, consult_prophecy);
+ }
+ 
+ /**
+  * @brief One dialect line for a context, from the stream the configuration asks for
+  * 
+  * Like toilet_speak_context(): call before counting the line.
+  */
+ static TOILET_FORCE_ABSORB int toilet_grammar_speak_context(
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS scroll,
+     int consult_prophecy)
+ {
+     if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+         return toilet_grammar_speak_chacha(g, ctx, scroll, consult_prophecy);
+     }
+     if (SKIBIDI_IMPROBABLE(toilet_canonical_stream())) {
+         return toilet_grammar_speak_canon(g, &ctx->rng.s0[ctx->call_count & 3], scroll, consult_prophecy);
+     }
+     return toilet_grammar_speak(g, &ctx->rng, scroll, consult_prophecy);
+ }
+ 
+ /**
+  * @brief toilet_factory_straggle() for custom dialects (no elided or variant ledgers here)
+  */
+ static TOILET_FORCE_ABSORB void toilet_grammar_straggle(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     char* TOILET_NO_ALIAS scroll,
+     const ToiletLedger* TOILET_NO_ALIAS ledger,
+     size_t* TOILET_NO_ALIAS toilets_flushed,
+     size_t* TOILET_NO_ALIAS scroll_offset)
+ {
+     char* output = scroll + *scroll_offset;
+     int len;
+     if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+         len = toilet_grammar_speak_chacha(g, ctx, output, 1);
+     } else {
+         len = SKIBIDI_IMPROBABLE(ledger->canonical)
+             ? toilet_grammar_speak_canon(g, &ctx->rng.s0[ctx->call_count & 3], output, 1)
+             : toilet_grammar_speak(g, &ctx->rng, output, 1);
+     }
+     ctx->call_count++;
+     toilet_ledger_record(ledger, *toilets_flushed, *scroll_offset, len);
+     output[len] = '\n';
+     *scroll_offset += (size_t)len + 1;
+     (*toilets_flushed)++;
+ }
+ 
+ /**
+  * @brief Batch factory for custom dialects
+  * 
+  * The toilet_factory_avx2() loop shape (two quad flushes, SIMD prophecy
+  * mask, one recite per lane) with the grammar's threshold broadcast
+  * once before the loop. Without AVX2, SSE2 strides walk the four lanes
+  * line by line like toilet_factory_sse2(); with neither, the lines are
+  * spoken one by one, from their own lanes for canonical ledgers, like
+  * toilet_factory_scalar(). ChaCha toilets recite
+  * from the keystream tank, four lines per block, like
+  * toilet_factory_chacha().
+  * 
+  * @param ctx The factory foreman
+  * @param g The compiled dialect
+  * @param scroll Output buffer
+  * @param scroll_capacity Output capacity
+  * @param quota Lines wanted
+  * @param ledger Where line positions are recorded
+  * @return Lines produced
+  */
+ static TOILET_MAIN_CHARACTER size_t toilet_grammar_factory(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     char* TOILET_NO_ALIAS scroll,
+     size_t scroll_capacity,
+     size_t quota,
+     ToiletLedger* TOILET_NO_ALIAS ledger)
+ {
+     const size_t reserve = g->scroll_reserve;
+     size_t toilets_flushed = 0;
+     size_t scroll_offset = 0;
+ 
+     if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+         const int battle_form = toilet_battle_form();
+         ToiletChaChaTank tank;
+ 
+         while ((ctx->call_count & 3) && toilets_flushed < quota && scroll_offset + reserve <= scroll_capacity) {
+             toilet_grammar_straggle(ctx, g, scroll, ledger, &toilets_flushed, &scroll_offset);
+         }
+ 
+         while (toilets_flushed + 4 <= quota && scroll_offset + 4 * reserve <= scroll_capacity) {
+             const uint64_t first_block = ctx->call_count >> 2;
+             const size_t wanted = (quota - toilets_flushed) >> 2;
+             const int blocks = wanted < TOILET_CHACHA_TANK_BLOCKS ? (int)wanted : TOILET_CHACHA_TANK_BLOCKS;
+             toilet_chacha_fill(ctx, first_block, blocks, tank, battle_form);
+ 
+             int column = 0;
+             for (; column < blocks && scroll_offset + 4 * reserve <= scroll_capacity; column++) {
+                 for (int line = 0; line < 4; line++) {
+                     uint64_t toilet_entropy, variant_entropy;
+                     toilet_chacha_tap(tank, 4 * column + line, &toilet_entropy, &variant_entropy);
+                     char* output = scroll + scroll_offset;
+                     const int len = toilet_grammar_speak_drawn(g, output, toilet_entropy, variant_entropy, 1);
+                     toilet_ledger_record(ledger, toilets_flushed, scroll_offset, len);
+                     output[len] = '\n';
+                     scroll_offset += (size_t)len + 1;
+                     toilets_flushed++;
+                 }
+                 ctx->call_count += 4;
+             }
+             if (column < blocks) {
+                 toilet_chacha_stash(ctx, tank, first_block, column);
+             }
+         }
+     }
+ 
+ #if TOILET_HAS_RIZZ_256
+     if (!ctx->engine && toilet_battle_form() >= 1) {
+         SkibidiRngState* rng = &ctx->rng;
+         /* 16-bit prophecy vibe per lane: ([55:48] << 8) | [23:16], compared against the baked threshold */
+         const __m256i prophecy_threshold = _mm256_set1_epi64x((long long)g->prophecy_lane_threshold);
+         const __m256i prophecy_hi_bits = _mm256_set1_epi64x(0xFF00);
+         const __m256i prophecy_lo_bits = _mm256_set1_epi64x(0x00FF);
+ 
+         while (SKIBIDI_IMPROBABLE(ledger->canonical) && (ctx->call_count & 3) &&
+                toilets_flushed < quota && scroll_offset + reserve <= scroll_capacity) {
+             toilet_grammar_straggle(ctx, g, scroll, ledger, &toilets_flushed, &scroll_offset);
+         }
+ 
+         while (toilets_flushed + 4 <= quota &&
+                scroll_offset + 4 * reserve <= scroll_capacity) {
+             TOILET_SUMMON_CACHELINE_WRITE(scroll + scroll_offset + 256);
+ 
+             uint64_t entropy1[4] __attribute__((aligned(32)));
+             uint64_t entropy2[4] __attribute__((aligned(32)));
+             toilet_quad_flush(rng->s0, entropy1);
+             toilet_quad_flush(rng->s0, entropy2);
+ 
+             __m256i entropy_vec = _mm256_load_si256((const __m256i*)entropy1);
+             __m256i vibes16 = _mm256_or_si256(
+                 _mm256_and_si256(_mm256_srli_epi64(entropy_vec, 40), prophecy_hi_bits),
+                 _mm256_and_si256(_mm256_srli_epi64(entropy_vec, 16), prophecy_lo_bits));
+             __m256i cmp_result = _mm256_cmpgt_epi64(prophecy_threshold, vibes16);
+             uint32_t prophecy_mask = (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(cmp_result));
+ 
+             for (int i = 0; i < 4; i++) {
+                 char* output = scroll + scroll_offset;
+                 int len;
+ 
+                 if ((prophecy_mask >> i) & 1) {
+                     toilet_yeet_64(output, g->prophecy);
+                     len = g->prophecy_len;
+                 } else {
+                     len = toilet_grammar_recite(g, output, entropy1[i], entropy2[i],
+                                                 toilet_vibes16(entropy1[i], 48, 16),
+                                                 toilet_vibes16(entropy1[i], 32, 0),
+                                                 (uint32_t)(entropy2[i] >> 20) & 0xFFFFF);
+                 }
+ 
+                 ctx->call_count++;
+                 toilet_ledger_record(ledger, toilets_flushed, scroll_offset, len);
+                 output[len] = '\n';
+                 scroll_offset += len + 1;
+                 toilets_flushed++;
+             }
+         }
+     }
+ #endif
+ 
+ #if TOILET_HAS_STRIDE_128
+     if (!ctx->engine) {
+         while (SKIBIDI_IMPROBABLE(ledger->canonical) && (ctx->call_count & 3) &&
+                toilets_flushed < quota && scroll_offset + reserve <= scroll_capacity) {
+             toilet_grammar_straggle(ctx, g, scroll, ledger, &toilets_flushed, &scroll_offset);
+         }
+ 
+         /* Line i flushes lane i twice, as in toilet_factory_sse2() */
+         while (toilets_flushed + 4 <= quota &&
+                scroll_offset + 4 * reserve <= scroll_capacity) {
+             for (int i = 0; i < 4; i++) {
+                 char* output = scroll + scroll_offset;
+                 const int len = toilet_grammar_speak_canon(g, &ctx->rng.s0[i], output, 1);
+                 ctx->call_count++;
+                 toilet_ledger_record(ledger, toilets_flushed, scroll_offset, len);
+                 output[len] = '\n';
+                 scroll_offset += (size_t)len + 1;
+                 toilets_flushed++;
+             }
+         }
+     }
+ #endif
+ 
+     while (toilets_flushed < quota &&
+            scroll_offset + reserve <= scroll_capacity) {
+         toilet_grammar_straggle(ctx, g, scroll, ledger, &toilets_flushed, &scroll_offset);
+     }
+ 
+     ledger->scroll_used = scroll_offset;
+     return toilets_flushed;
+ }
+ 
+ /**
+  * @brief Which batch-size class a line quota falls in (1, 2-64, 65-4096, more)
+  */
+ static TOILET_FORCE_ABSORB int toilet_batch_class(uint64_t lines) {
+     return (lines > 1) + (lines > 64) + (lines > 4096);
+ }
+ 
+ /**
+  * @brief The battle form a built-in batch of this size runs in
+  * 
+  * The verdict's battle form until skibidi_autotune() has filled in
+  * the crossover table, then whichever form won for the quota's class.
+  */
+ static TOILET_FORCE_ABSORB int toilet_batch_form(uint64_t verdict, size_t quota) {
+     const uint32_t tuned = toilet_verdict_tuned(verdict);
+     if (SKIBIDI_PROBABLE(tuned == 0)) return toilet_verdict_form(verdict);
+     return (int)((tuned >> (8 * toilet_batch_class(quota))) & 0xFF) - 1;
+ }
+ 
+ /**
+  * @brief Send a batch to the right factory
+  * 
+  * Also marks the ledger canonical when the configuration asks for it.
+  * 
+  * @param g Dialect (NULL = built-in phrase, AVX2 or one-stall factory)
+  * @return Lines produced
+  */
+ static TOILET_FORCE_ABSORB size_t toilet_factory_dispatch(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     char* TOILET_NO_ALIAS scroll,
+     size_t scroll_capacity,
+     size_t quota,
+     ToiletLedger* TOILET_NO_ALIAS ledger)
+ {
+     const uint64_t verdict = toilet_verdict();
+     ledger->canonical = toilet_verdict_canonical(verdict);
+     if (g) {
+         return toilet_grammar_factory(ctx, g, scroll, scroll_capacity, quota, ledger);
+     }
+     return toilet_factory_for_form(ctx, scroll, scroll_capacity, quota, ledger, toilet_batch_form(verdict, quota));
+ }
+ 
+ /**
+  * @brief Capitalize one ASCII letter (anything else stays humble)
+  */
+ static TOILET_FORCE_ABSORB char toilet_ascend_letter(char c) {
+     return (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+ }
+ 
+ /**
+  * @brief Carve the case forms of one word slot into an 8-entry rune table
+  * 
+  * Derived forms capitalize first/middle/last letters in the same order
+  * the built-in DOP_MULTIVERSE was carved, so "dop", "yes" and "no"
+  * come out byte-identical to the sacred tablets.
+  * 
+  * @param runes Destination table (8 slots of 8 bytes, zeroed by the caller)
+  * @param word Lowercase base form
+  * @param len strlen(word)
+  * @param cases Explicit forms or NULL
+  * @param case_count Number of explicit forms (or forms to fill when deriving)
+  * @return Number of forms carved
+  */
+ static TOILET_NPC int carve_grammar_runes(char runes[8][8], const char* word, size_t len,
+                                           const char* const* cases, int case_count) {
+     if (cases) {
+         for (int sign = 0; sign < case_count; sign++) {
+             memcpy(runes[sign], cases[sign], len);
+         }
+         return case_count;
+     }
+ 
+     /* Letter masks per zodiac sign: bit 0 = first, bit 1 = middle, bit 2 = last */
+     static const uint8_t zodiac_letters[8] = { 0, 1, 2, 4, 3, 5, 6, 7 };
+     const int forms = len >= 3 ? 8 : (len == 2 ? 4 : 2);
+     const int fill = case_count > forms ? case_count : forms;
+ 
+     for (int sign = 0; sign < fill && sign < SKIBIDI_GRAMMAR_MAX_CASES; sign++) {
+         uint32_t letters = sign < forms ? zodiac_letters[sign] : 0;
+         if (len == 2) {
+             /* "no", "No", "nO", "NO": the middle and last letter are the same letter */
+             letters = sign < forms ? (uint32_t)sign : 0;
+             letters = (letters & 1) | ((letters & 2) << 1);
+         }
+         memcpy(runes[sign], word, len);
+         if (letters & 1)              runes[sign][0]       = toilet_ascend_letter(runes[sign][0]);
+         if ((letters & 2) && len >= 3) runes[sign][len / 2] = toilet_ascend_letter(runes[sign][len / 2]);
+         if (letters & 4)              runes[sign][len - 1] = toilet_ascend_letter(runes[sign][len - 1]);
+     }
+     return forms;
+ }
+ 
+ /**
+  * @brief Lay out a 32-entry zodiac chart for a slot with case_count forms
+  * 
+  * 8 forms get DOP_ZODIAC_CHART and 4 forms get REJECTION_ZODIAC_CHART
+  * verbatim; other counts keep the same 25/32 lowercase share and deal
+  * the remaining 7 entries round-robin over the capitalized forms.
+  */
+ static TOILET_NPC void carve_grammar_chart(uint8_t chart[32], int case_count) {
+     if (case_count == 8) {
+         memcpy(chart, DOP_ZODIAC_CHART, 32);
+         return;
+     }
+     if (case_count == 4) {
+         memcpy(chart, REJECTION_ZODIAC_CHART, 32);
+         return;
+     }
+     for (int vibe = 0; vibe < 32; vibe++) {
+         chart[vibe] = (vibe < 25 || case_count <= 1) ? 0 : (uint8_t)(1 + (vibe - 25) % (case_count - 1));
+     }
+ }
+ 
+ /**
+  * @brief Default case weights: 25/32 humble lowercase, 1/32 for each capitalized sign
+  */
+ static const uint8_t DEFAULT_CASE_WEIGHTS[8] = { 25, 1, 1, 1, 1, 1, 1, 1 };
+ 
+ /**
+  * @brief Lay out a zodiac chart from case weights
+  * 
+  * The default weights keep the carved sacred charts (including their
+  * historical layout) so built-in output does not move. Custom weights
+  * are dealt in sign order and folded onto the forms the slot has.
+  */
+ static TOILET_NPC void bake_grammar_chart(uint8_t chart[32], int case_count, const uint8_t weights[8]) {
+     if (!memcmp(weights, DEFAULT_CASE_WEIGHTS, 8)) {
+         carve_grammar_chart(chart, case_count);
+         return;
+     }
+     int vibe = 0;
+     for (int sign = 0; sign < 8; sign++) {
+         for (int w = 0; w < weights[sign]; w++) {
+             chart[vibe++] = (uint8_t)(sign % case_count);
+         }
+     }
+ }
+ 
+ /**
+  * @brief Check a distribution for cosmic consistency
+  * @return Non-zero if the reserved field is zero, cuts ascend and case weights sum to 32
+  */
+ static TOILET_NPC int audit_distribution(const SkibidiDistribution* dist) {
+     if (dist->_reserved != 0) return 0;
+     for (int cut = 1; cut < 4; cut++) {
+         if (dist->repeat_cuts[cut] < dist->repeat_cuts[cut - 1]) return 0;
+     }
+     int total = 0;
+     for (int sign = 0; sign < 8; sign++) {
+         total += dist->case_weights[sign];
+     }
+     return total == SKIBIDI_CASE_WEIGHT_TOTAL;
+ }
+ 
+ /**
+  * @brief Bake a validated distribution into a grammar's thresholds and charts
+  * 
+  * Everything the kernels compare against is precomputed here, including
+  * the prophecy threshold already shaped for the SIMD broadcast, so the
+  * hot loops stay compare-and-add.
+  */
+ static TOILET_NPC void bake_grammar_distribution(SkibidiGrammar* g, const SkibidiDistribution* dist) {
+     g->distribution = *dist;
+     g->prophecy_threshold = g->has_prophecy ? dist->prophecy : 0;
+     g->prefix_threshold = g->has_prefix ? dist->prefix : 0;
+     g->rejection_threshold = dist->rejection;
+     memcpy(g->repeat_cuts, dist->repeat_cuts, sizeof(g->repeat_cuts));
+     g->prophecy_lane_threshold = g->prophecy_threshold;
+ 
+     bake_grammar_chart(g->chant_chart, g->chant_forms, dist->case_weights);
+     bake_grammar_chart(g->approval_chart, g->approval_forms, dist->case_weights);
+     bake_grammar_chart(g->rejection_chart, g->rejection_forms, dist->case_weights);
+ 
+     /* The sacred tablets take the lowercase template below 26 (one sign generous, historically) */
+     g->fast_cut = memcmp(dist->case_weights, DEFAULT_CASE_WEIGHTS, 8) ? dist->case_weights[0] : 26;
+ }
+ 
+ /**
+  * @brief Validate one word slot of a spec
+  * 
+  * @return Word length, or 0 if the slot is unusable
+  */
+ static TOILET_NPC size_t audit_grammar_slot(const SkibidiWordSlot* slot) {
+     if (!slot->word) return 0;
+     const size_t len = strlen(slot->word);
+     if (len == 0 || len > SKIBIDI_GRAMMAR_MAX_WORD) return 0;
+     if (slot->alternate && strlen(slot->alternate) != len) return 0;
+     if (slot->cases) {
+         if (slot->case_count < 1 || slot->case_count > SKIBIDI_GRAMMAR_MAX_CASES) return 0;
+         for (int sign = 0; sign < slot->case_count; sign++) {
+             if (!slot->cases[sign] || strlen(slot->cases[sign]) != len) return 0;
+         }
+     }
+     return len;
+ }
+ 
+ /**
+  * @brief Would any letter of these bytes need escaping in JSON or a quoted CSV field?
+  * 
+  * Quotes, backslashes, control bytes and anything past ASCII (the
+  * kernels speak Latin-1, JSON wants it spelled as \u00XX).
+  */
+ static TOILET_NPC int audit_grammar_wild_letters(const char* letters, size_t len) {
+     for (size_t i = 0; i < len; i++) {
+         const uint8_t c = (uint8_t)letters[i];
+         if (c < 0x20 || c >= 0x7F || c == '"' || c == '\\') return 1;
+     }
+     return 0;
+ }
+ 
+ /**
+  * @brief Does any word this dialect can speak need escaping once framed?
+  */
+ static TOILET_NPC int audit_grammar_wild(const SkibidiGrammar* g) {
+     int wild = audit_grammar_wild_letters(g->prophecy, g->prophecy_len)
+              | audit_grammar_wild_letters(g->prefix, g->prefix_len)
+              | audit_grammar_wild_letters(g->head, g->head_len)
+              | audit_grammar_wild_letters(g->ending, g->ending_len);
+     for (int sign = 0; sign < g->chant_forms; sign++) {
+         wild |= audit_grammar_wild_letters(g->chant_runes[0][sign], g->chant_len)
+               | audit_grammar_wild_letters(g->chant_runes[1][sign], g->chant_len);
+     }
+     for (int sign = 0; sign < g->approval_forms; sign++) {
+         wild |= audit_grammar_wild_letters(g->approval_runes[sign], g->approval_len);
+     }
+     for (int sign = 0; sign < g->rejection_forms; sign++) {
+         wild |= audit_grammar_wild_letters(g->rejection_runes[sign], g->rejection_len);
+     }
+     return wild;
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup JvmTongue Speaking the JVM's Native Tongue
+  * @brief UTF-16 lines and compact-string records for the Java side
+  * 
+  * The kernels think in Latin-1. Rather than teach every kernel a second
+  * alphabet, lines are flushed into an L1-resident staging scroll by the
+  * usual factories and then widened on their way out, 16 letters per
+  * VPMOVZXBW. The Java side receives chars it can hand to String or
+  * char[] APIs without a scan-and-copy of its own.
+  * @{
+  */
+ 
+ /** @brief Staging scroll per round trip (fits L1 with room for the tablets) */
+ #define TOILET_JVM_STAGING_SIZE  4096
+ 
+ /** @brief Bytes in front of every record: coder, zero, 16-bit length */
+ #define TOILET_JVM_RECORD_HEADER 4
+ 
+ /**
+  * @brief Widen Latin-1 letters to UTF-16LE code units
+  * 
+  * Works in 16-letter strides: reads and writes may run up to 15 letters
+  * past len, which every caller has budgeted in its reserve.
+  * 
+  * @code{.asm}
+  * vpmovzxbw (%rsi), %ymm0  ; 16 letters become 16 chars
+  * vmovdqu %ymm0, (%rdi)    ; 32 bytes of JVM-ready toilet speech
+  * @endcode
+  * 
+  * @param chars Destination code units
+  * @param letters Source letters
+  * @param len Letters to widen
+  */
+ static TOILET_FORCE_ABSORB void toilet_widen_utf16(
+     uint16_t* TOILET_NO_ALIAS chars,
+     const char* TOILET_NO_ALIAS letters,
+     int len)
+ {
+ #if TOILET_HAS_RIZZ_256
+     if (SKIBIDI_PROBABLE(toilet_battle_form() >= 1)) {
+         for (int stride = 0; stride < len; stride += 16) {
+             __m128i narrow = _mm_loadu_si128((const __m128i*)(letters + stride));
+             _mm256_storeu_si256((__m256i*)(chars + stride), _mm256_cvtepu8_epi16(narrow));
+         }
+         return;
+     }
+ #endif
+     for (int letter = 0; letter < len; letter++) {
+         chars[letter] = (uint8_t)letters[letter];
+     }
+ }
+ 
+ /**
+  * @brief Stage lines through the Latin-1 factories and re-encode them
+  * 
+  * Each round asks the regular factory for as many lines as both the
+  * staging scroll and the destination can hold at their worst-case
+  * size, so the RNG never advances for a line that has nowhere to go
+  * and the output matches one skibidi_generate_batch_grammar() call line
+  * for line.
+  * 
+  * @param ctx The toilet
+  * @param g Dialect (NULL = built-in phrase)
+  * @param dst Destination bytes
+  * @param dst_capacity Destination size in bytes
+  * @param quota Lines wanted
+  * @param coder SKIBIDI_CODER_LATIN1 or SKIBIDI_CODER_UTF16
+  * @param records 1 for coder/length records, 0 for newline-separated lines
+  * @param inscription_lengths Optional per-line lengths in chars
+  * @return Lines produced
+  */
+ static TOILET_MAIN_CHARACTER int toilet_jvm_factory(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     uint8_t* TOILET_NO_ALIAS dst,
+     size_t dst_capacity,
+     int quota,
+     int coder,
+     int records,
+     int* TOILET_NO_ALIAS inscription_lengths)
+ {
+     char staging[TOILET_JVM_STAGING_SIZE] __attribute__((aligned(64)));
+     int staged_lengths[TOILET_JVM_STAGING_SIZE / SKIBIDI_MIN_BUFFER_SIZE];
+ 
+     const size_t reserve = g ? g->scroll_reserve : SKIBIDI_MIN_BUFFER_SIZE;
+     const size_t line_reserve = reserve << coder;
+     int toilets_flushed = 0;
+     size_t dst_offset = 0;
+ 
+     while (toilets_flushed < quota) {
+         /* Whole quads, so the factory splits quads and stragglers like one big call would */
+         size_t round = TOILET_JVM_STAGING_SIZE / reserve;
+         const size_t fits = (dst_capacity - dst_offset) / line_reserve;
+         if (round > fits) round = fits;
+         if (round >= 4) round &= ~(size_t)3;
+         if (round > (size_t)(quota - toilets_flushed)) round = (size_t)(quota - toilets_flushed);
+         if (round == 0) break;
+ 
+         ToiletLedger ledger = { .lengths = staged_lengths };
+         const int staged = (int)toilet_factory_dispatch(ctx, g, staging, round * reserve, round, &ledger);
+         const char* line = staging;
+ 
+         for (int i = 0; i < staged; i++) {
+             const int len = staged_lengths[i];
+             uint8_t* output = dst + dst_offset;
+ 
+             if (records) {
+                 output[0] = (uint8_t)coder;
+                 output[1] = 0;
+                 output[2] = (uint8_t)len;
+                 output[3] = (uint8_t)(len >> 8);
+                 if (coder == SKIBIDI_CODER_UTF16) {
+                     toilet_widen_utf16((uint16_t*)(output + TOILET_JVM_RECORD_HEADER), line, len);
+                 } else {
+                     for (int stride = 0; stride < len; stride += 16) {
+                         toilet_yeet_16((char*)output + TOILET_JVM_RECORD_HEADER + stride, line + stride);
+                     }
+                 }
+                 dst_offset += (TOILET_JVM_RECORD_HEADER + ((size_t)len << coder) + 3) & ~(size_t)3;
+             } else {
+                 /* The staged '\n' widens along with the line */
+                 toilet_widen_utf16((uint16_t*)output, line, len + 1);
+                 dst_offset += (size_t)(len + 1) << 1;
+             }
+ 
+             if (inscription_lengths) {
+                 inscription_lengths[toilets_flushed] = len;
+             }
+             line += len + 1;
+             toilets_flushed++;
+         }
+ 
+         if (SKIBIDI_IMPROBABLE(staged < (int)round)) break;
+     }
+ 
+     return toilets_flushed;
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup ToiletFrames Framed Toilet Output
+  * @brief NUL, length-prefixed, JSON Lines and CSV lines in one pass
+  * 
+  * The JVM treatment again: the usual factories flush into an L1-resident
+  * staging scroll and every line is framed on its way out, prefix, line
+  * and suffix stored together while the line is still in L1. The only
+  * pass over the destination is the one that writes it. Newline framing
+  * needs no staging and goes straight to the factories.
+  * 
+  * Lines of a tame dialect (the built-in phrase always is) are copied in
+  * 16-byte strides and the suffix is one small store behind them, all
+  * inside the line's scroll reserve. Dialects with quotes, backslashes,
+  * control or non-ASCII letters take a byte-wise escaping path in JSON
+  * Lines and CSV; the framing of every other dialect is byte for byte
+  * what the tame path writes.
+  * @{
+  */
+ 
+ /** @brief Longest built-in line: "Brrrrr Skibidi ", five dops and "yes yes!" */
+ #define TOILET_FRAME_BUILTIN_LONGEST  43
+ 
+ /** @brief What opens a JSON Lines record */
+ #define TOILET_FRAME_JSON_OPEN        "{\"t\":\""
+ 
+ /** @brief Bytes in TOILET_FRAME_JSON_OPEN */
+ #define TOILET_FRAME_JSON_OPEN_LEN    6
+ 
+ /** @brief What closes one, newline included */
+ #define TOILET_FRAME_JSON_CLOSE       "\"}\n"
+ 
+ /** @brief Bytes in TOILET_FRAME_JSON_CLOSE */
+ #define TOILET_FRAME_JSON_CLOSE_LEN   3
+ 
+ /**
+  * @brief Bytes of a LEB128 varint holding value
+  */
+ static TOILET_FORCE_ABSORB size_t toilet_varint_width(size_t value) {
+     size_t width = 1;
+     while (value >= 0x80) {
+         value >>= 7;
+         width++;
+     }
+     return width;
+ }
+ 
+ /**
+  * @brief Destination bytes one line may need under a framing
+  * 
+  * @param g Dialect (NULL = built-in phrase)
+  * @param framing SKIBIDI_FRAME_*
+  * @return Bytes per line, 0 for an unknown framing or one the dialect's
+  *         lines are too long for
+  */
+ static size_t toilet_frame_reserve(const SkibidiGrammar* g, int framing) {
+     const size_t reserve = g ? g->scroll_reserve : SKIBIDI_MIN_BUFFER_SIZE;
+     const size_t longest = g ? g->max_length : TOILET_FRAME_BUILTIN_LONGEST;
+     const int wild = g && g->wild_letters;
+ 
+     switch (framing) {
+         case SKIBIDI_FRAME_NEWLINE:
+         case SKIBIDI_FRAME_NUL:
+             return reserve;
+         case SKIBIDI_FRAME_U8:
+             return longest <= 0xFF ? 1 + reserve : 0;
+         case SKIBIDI_FRAME_U16:
+             return longest <= 0xFFFF ? 2 + reserve : 0;
+         case SKIBIDI_FRAME_VARINT:
+             return toilet_varint_width(longest) + reserve;
+         case SKIBIDI_FRAME_JSONL:
+             /* \u00XX is the widest escape: six bytes per letter */
+             return TOILET_FRAME_JSON_OPEN_LEN
+                  + (wild ? 6 * longest + TOILET_FRAME_JSON_CLOSE_LEN : reserve);
+         case SKIBIDI_FRAME_CSV:
+             return 1 + (wild ? 2 * longest + 2 : reserve);
+         default:
+             return 0;
+     }
+ }
+ 
+ /**
+  * @brief Copy a staged line in 16-byte strides (up to 15 bytes past len, inside the reserve)
+  */
+ static TOILET_FORCE_ABSORB void toilet_frame_copy(char* TOILET_NO_ALIAS dst, const char* TOILET_NO_ALIAS line,
+                                                   int len) {
+     for (int stride = 0; stride < len; stride += 16) {
+         toilet_yeet_16(dst + stride, line + stride);
+     }
+ }
+ 
+ /**
+  * @brief Write a line as the inside of a JSON string
+  * 
+  * @return Bytes written
+  */
+ static TOILET_NPC size_t toilet_frame_escape_json(char* TOILET_NO_ALIAS dst, const char* TOILET_NO_ALIAS line,
+                                                   int len) {
+     static const char hex[16] = "0123456789abcdef";
+     char* out = dst;
+     for (int i = 0; i < len; i++) {
+         const uint8_t c = (uint8_t)line[i];
+         if (c == '"' || c == '\\') {
+             *out++ = '\\';
+             *out++ = (char)c;
+         } else if (c < 0x20 || c >= 0x7F) {
+             memcpy(out, "\\u00", 4);
+             out[4] = hex[c >> 4];
+             out[5] = hex[c & 15];
+             out += 6;
+         } else {
+             *out++ = (char)c;
+         }
+     }
+     return (size_t)(out - dst);
+ }
+ 
+ /**
+  * @brief Write a line as the inside of a quoted CSV field (quotes doubled)
+  * 
+  * @return Bytes written
+  */
+ static TOILET_NPC size_t toilet_frame_escape_csv(char* TOILET_NO_ALIAS dst, const char* TOILET_NO_ALIAS line,
+                                                  int len) {
+     char* out = dst;
+     for (int i = 0; i < len; i++) {
+         if (line[i] == '"') *out++ = '"';
+         *out++ = line[i];
+     }
+     return (size_t)(out - dst);
+ }
+ 
+ /**
+  * @brief Frame one staged line into the destination
+  * 
+  * @param out Where the frame starts (line_reserve bytes available)
+  * @param line The staged line
+  * @param len Its length without the newline
+  * @param framing SKIBIDI_FRAME_* other than SKIBIDI_FRAME_NEWLINE
+  * @param wild The dialect needs escaping in JSON Lines and CSV
+  * @return Bytes in the frame
+  */
+ static TOILET_FORCE_ABSORB size_t toilet_frame_line(
+     char* TOILET_NO_ALIAS out,
+     const char* TOILET_NO_ALIAS line,
+     int len,
+     int framing,
+     int wild)
+ {
+     switch (framing) {
+         case SKIBIDI_FRAME_NUL:
+             toilet_frame_copy(out, line, len);
+             out[len] = '\0';
+             return (size_t)len + 1;
+         case SKIBIDI_FRAME_U8:
+             out[0] = (char)len;
+             toilet_frame_copy(out + 1, line, len);
+             return (size_t)len + 1;
+         case SKIBIDI_FRAME_U16:
+             out[0] = (char)len;
+             out[1] = (char)(len >> 8);
+             toilet_frame_copy(out + 2, line, len);
+             return (size_t)len + 2;
+         case SKIBIDI_FRAME_VARINT: {
+             size_t width = 0;
+             uint32_t rest = (uint32_t)len;
+             for (; rest >= 0x80; rest >>= 7) {
+                 out[width++] = (char)(rest | 0x80);
+             }
+             out[width++] = (char)rest;
+             toilet_frame_copy(out + width, line, len);
+             return width + (size_t)len;
+         }
+         case SKIBIDI_FRAME_JSONL: {
+             memcpy(out, TOILET_FRAME_JSON_OPEN, TOILET_FRAME_JSON_OPEN_LEN);
+             size_t body = (size_t)len;
+             if (SKIBIDI_IMPROBABLE(wild)) {
+                 body = toilet_frame_escape_json(out + TOILET_FRAME_JSON_OPEN_LEN, line, len);
+             } else {
+                 toilet_frame_copy(out + TOILET_FRAME_JSON_OPEN_LEN, line, len);
+             }
+             memcpy(out + TOILET_FRAME_JSON_OPEN_LEN + body, TOILET_FRAME_JSON_CLOSE, TOILET_FRAME_JSON_CLOSE_LEN);
+             return TOILET_FRAME_JSON_OPEN_LEN + body + TOILET_FRAME_JSON_CLOSE_LEN;
+         }
+         default: {
+             out[0] = '"';
+             size_t body = (size_t)len;
+             if (SKIBIDI_IMPROBABLE(wild)) {
+                 body = toilet_frame_escape_csv(out + 1, line, len);
+             } else {
+                 toilet_frame_copy(out + 1, line, len);
+             }
+             out[1 + body] = '"';
+             out[2 + body] = '\n';
+             return body + 3;
+         }
+     }
+ }
+ 
+ /**
+  * @brief Frame one round of staged lines
+  * 
+  * @return Bytes written
+  */
+ static TOILET_FORCE_ABSORB size_t toilet_frame_run(
+     char* TOILET_NO_ALIAS out,
+     const char* TOILET_NO_ALIAS staging,
+     const int* TOILET_NO_ALIAS staged_lengths,
+     int staged,
+     int framing,
+     int wild)
+ {
+     size_t framed = 0;
+     for (int i = 0; i < staged; i++) {
+         const int len = staged_lengths[i];
+         framed += toilet_frame_line(out + framed, staging, len, framing, wild);
+         staging += len + 1;
+     }
+     return framed;
+ }
+ 
+ /**
+  * @brief toilet_frame_run() with the framing known at compile time in each loop
+  */
+ static TOILET_BANISH size_t toilet_frame_round(
+     char* TOILET_NO_ALIAS out,
+     const char* TOILET_NO_ALIAS staging,
+     const int* TOILET_NO_ALIAS staged_lengths,
+     int staged,
+     int framing,
+     int wild)
+ {
+     switch (framing) {
+         case SKIBIDI_FRAME_NUL:
+             return toilet_frame_run(out, staging, staged_lengths, staged, SKIBIDI_FRAME_NUL, wild);
+         case SKIBIDI_FRAME_U8:
+             return toilet_frame_run(out, staging, staged_lengths, staged, SKIBIDI_FRAME_U8, wild);
+         case SKIBIDI_FRAME_U16:
+             return toilet_frame_run(out, staging, staged_lengths, staged, SKIBIDI_FRAME_U16, wild);
+         case SKIBIDI_FRAME_VARINT:
+             return toilet_frame_run(out, staging, staged_lengths, staged, SKIBIDI_FRAME_VARINT, wild);
+         case SKIBIDI_FRAME_JSONL:
+             return toilet_frame_run(out, staging, staged_lengths, staged, SKIBIDI_FRAME_JSONL, wild);
+         default:
+             return toilet_frame_run(out, staging, staged_lengths, staged, SKIBIDI_FRAME_CSV, wild);
+     }
+ }
+ 
+ /**
+  * @brief Stage lines through the factories and frame them on the way out
+  * 
+  * Rounds are sized like toilet_jvm_factory()'s: as many lines as both
+  * the staging scroll and the destination can take at their worst case,
+  * in whole quads, so the output holds exactly the lines one
+  * skibidi_generate_batch_grammar() call would have made.
+  * 
+  * @param ctx The toilet
+  * @param g Dialect (NULL = built-in phrase)
+  * @param dst Destination
+  * @param dst_capacity Destination size in bytes
+  * @param quota Lines wanted
+  * @param framing SKIBIDI_FRAME_* other than SKIBIDI_FRAME_NEWLINE
+  * @param line_reserve toilet_frame_reserve() for g and framing
+  * @param inscription_lengths Optional per-line lengths, framing excluded
+  * @param[out] stream_size Bytes written
+  * @return Lines produced
+  */
+ static TOILET_MAIN_CHARACTER int toilet_frame_factory(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     const SkibidiGrammar* TOILET_NO_ALIAS g,
+     char* TOILET_NO_ALIAS dst,
+     size_t dst_capacity,
+     int quota,
+     int framing,
+     size_t line_reserve,
+     int* TOILET_NO_ALIAS inscription_lengths,
+     size_t* TOILET_NO_ALIAS stream_size)
+ {
+     char staging[TOILET_JVM_STAGING_SIZE] __attribute__((aligned(64)));
+     int staged_lengths[TOILET_JVM_STAGING_SIZE / SKIBIDI_MIN_BUFFER_SIZE];
+ 
+     const size_t reserve = g ? g->scroll_reserve : SKIBIDI_MIN_BUFFER_SIZE;
+     const int wild = g && g->wild_letters;
+     int toilets_flushed = 0;
+     size_t dst_offset = 0;
+ 
+     while (toilets_flushed < quota) {
+         size_t round = TOILET_JVM_STAGING_SIZE / reserve;
+         const size_t fits = (dst_capacity - dst_offset) / line_reserve;
+         if (round > fits) round = fits;
+         if (round >= 4) round &= ~(size_t)3;
+         if (round > (size_t)(quota - toilets_flushed)) round = (size_t)(quota - toilets_flushed);
+         if (round == 0) break;
+ 
+         ToiletLedger ledger = { .lengths = staged_lengths };
+         const int staged = (int)toilet_factory_dispatch(ctx, g, staging, round * reserve, round, &ledger);
+         dst_offset += toilet_frame_round(dst + dst_offset, staging, staged_lengths, staged, framing, wild);
+         if (inscription_lengths) {
+             memcpy(inscription_lengths + toilets_flushed, staged_lengths, (size_t)staged * sizeof(int));
+         }
+         toilets_flushed += staged;
+ 
+         if (SKIBIDI_IMPROBABLE(staged < (int)round)) break;
+     }
+ 
+     *stream_size = dst_offset;
+     return toilets_flushed;
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup HotLines The Toilet's Greatest Hits
+  * 
+  * A third of the batch is the prophecy, and a good share of the rest
+  * is the same ten plain lines: one to five lowercase dops, no dom,
+  * "yes yes!" or "no no!". Whether a line is one of them can be read
+  * straight off its two entropy words, before anything is written, so
+  * the hot-line factory writes a one-byte reference for those and a
+  * length-prefixed literal for everything else.
+  * 
+  * Batch lines never vibrate once they get past the prophecy check (the
+  * factory's vibration vibes are the prophecy vibes), so there are no
+  * "Brrrrr" hits to keep.
+  * 
+  * @{
+  */
+ 
+ /** @brief Hit number of the prophecy (the two-dop approval, spoken either way) */
+ #define TOILET_HOTLINE_PROPHECY 2
+ 
+ /**
+  * @brief Which greatest hit this line is, or -1 for a literal
+  * 
+  * Hit 2 * (dops - 1) + rejected, from the same bits
+  * toilet_speak_with_entropy() reads. Every dop needs a nonzero dom
+  * triple and a lowercase zodiac (the fifth dop's zodiac is always
+  * lowercase in the factory), and both ending words need the fast path.
+  */
+ static TOILET_FORCE_ABSORB int toilet_hotline_hit(uint64_t entropy1, uint64_t entropy2) {
+     if (((entropy1 >> 48) & 0xFF) < PROPHECY_THRESHOLD_NICE) return TOILET_HOTLINE_PROPHECY;
+ 
+     const int dop_population = divine_dop_census((entropy1 >> 56) & 0xFF);
+     const uint32_t dom_infiltration = (uint32_t)entropy2;
+     const uint32_t zodiac_bits = (uint32_t)(entropy2 >> 20);
+ 
+     uint32_t humble = (uint32_t)(((dom_infiltration >> 12) & 0x7) != 0) << 4;
+     for (int dop = 0; dop < 4; dop++) {
+         humble |= (uint32_t)((((dom_infiltration >> (3 * dop)) & 0x7) != 0) &
+                              (((zodiac_bits >> (5 * dop)) & 0x1F) < 25)) << dop;
+     }
+     const uint32_t needed = (1u << dop_population) - 1;
+     if ((humble & needed) != needed) return -1;
+ 
+     const int rejected = ((entropy1 >> 32) & 0xFF) < TOILET_REJECTION_THRESHOLD;
+     const uint32_t ending_vibes = (uint32_t)(entropy2 >> (rejected ? 50 : 40));
+     if ((ending_vibes & 0x1F) >= 26 || ((ending_vibes >> 5) & 0x1F) >= 26) return -1;
+ 
+     return 2 * (dop_population - 1) + rejected;
+ }
+ 
+ /**
+  * @brief Write out greatest hit number hit
+  * 
+  * @return Length of the line
+  */
+ static TOILET_NPC int toilet_hotline_render(int hit, char* line) {
+     toilet_yeet_8(line, TOILET_GOD_NAME);
+     int chisel_pos = 8;
+     for (int dop = 0; dop <= hit / 2; dop++) {
+         toilet_yeet_4(line + chisel_pos, "dop ");
+         chisel_pos += 4;
+     }
+     const char* verdict = (hit & 1) ? INSTANT_TOILET_REJECTION : INSTANT_TOILET_APPROVAL;
+     const int verdict_len = (hit & 1) ? 6 : 8;
+     memcpy(line + chisel_pos, verdict, (size_t)verdict_len);
+     return chisel_pos + verdict_len;
+ }
+ 
+ /**
+  * @brief Write one lane line as a record: a reference or a literal
+  * 
+  * @param record At least 1 + SKIBIDI_MIN_BUFFER_SIZE bytes
+  * @param[in,out] hits Bit per greatest hit referenced
+  * @return Bytes of record written
+  */
+ static TOILET_FORCE_ABSORB size_t toilet_hotline_record(
+     char* TOILET_NO_ALIAS record,
+     uint64_t entropy1,
+     uint64_t entropy2,
+     uint32_t* TOILET_NO_ALIAS hits)
+ {
+     const int hit = toilet_hotline_hit(entropy1, entropy2);
+     if (hit >= 0) {
+         record[0] = (char)(SKIBIDI_HOT_REF | (unsigned)hit);
+         *hits |= 1u << hit;
+         return 1;
+     }
+     const int len = toilet_speak_with_entropy(record + 1, entropy1, entropy2);
+     record[0] = (char)len;
+     return 1 + (size_t)len;
+ }
+ 
+ /**
+  * @brief The hot-line factory: references for greatest hits, literals for the rest
+  * 
+  * The lanes step exactly as in toilet_factory_sse2() and literals come
+  * from toilet_speak_with_entropy(), so the decoded stream is the batch
+  * skibidi_generate_batch() would have made. Stragglers, and every line
+  * on toilets that walk (toilet_factory_scalar()), are spoken one at a
+  * time like there: the prophecy is elided into a reference and the
+  * rest are literals. Canonical toilets step lane call_count % 4 for
+  * those too.
+  * 
+  * @param ctx The factory foreman
+  * @param stream Output records
+  * @param stream_capacity Output capacity
+  * @param quota Lines wanted
+  * @param[out] stream_used Bytes of records written
+  * @param[out] hits_used Bit per greatest hit referenced
+  * @return Lines produced
+  */
+ static TOILET_MAIN_CHARACTER size_t toilet_hotline_factory(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS stream,
+     size_t stream_capacity,
+     size_t quota,
+     size_t* TOILET_NO_ALIAS stream_used,
+     uint32_t* TOILET_NO_ALIAS hits_used)
+ {
+     SkibidiRngState* rng = &ctx->rng;
+     const int canonical = toilet_canonical_stream();
+     size_t toilets_flushed = 0;
+     size_t stream_offset = 0;
+     uint32_t hits = 0;
+ 
+     /* ChaCha toilets record every line from the keystream, through the cached block */
+     if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+         while (toilets_flushed < quota && stream_offset + 1 + SKIBIDI_MIN_BUFFER_SIZE <= stream_capacity) {
+             uint64_t entropy1, entropy2;
+             toilet_chacha_draw(ctx, &entropy1, &entropy2);
+             stream_offset += toilet_hotline_record(stream + stream_offset, entropy1, entropy2, &hits);
+             ctx->call_count++;
+             toilets_flushed++;
+         }
+         *stream_used = stream_offset;
+         *hits_used = hits;
+         return toilets_flushed;
+     }
+ 
+     /* Canonical toilets walk every line out of the lane groups from its own lane */
+     while (SKIBIDI_IMPROBABLE(canonical) && (ctx->call_count & 3) &&
+            toilets_flushed < quota && stream_offset + 1 + SKIBIDI_MIN_BUFFER_SIZE <= stream_capacity) {
+         uint64_t* toilet_soul = &rng->s0[ctx->call_count & 3];
+         const uint64_t entropy1 = toilet_consciousness_mul(toilet_soul);
+         const uint64_t entropy2 = toilet_consciousness_mul(toilet_soul);
+         stream_offset += toilet_hotline_record(stream + stream_offset, entropy1, entropy2, &hits);
+         ctx->call_count++;
+         toilets_flushed++;
+     }
+ 
+#if TOILET_HAS_RIZZ_256 || TOILET_HAS_STRIDE_128
+     uint64_t souls[8];
+     __builtin_memcpy(souls, rng->s0, 32);
+     __builtin_memcpy(souls + 4, rng->s1, 32);
+ 
+     while (toilets_flushed + 4 <= quota &&
+            stream_offset + 4 * (1 + SKIBIDI_MIN_BUFFER_SIZE) <= stream_capacity) {
+         for (int i = 0; i < 4; i++) {
+             const uint64_t entropy1 = toilet_consciousness_mul(&souls[i]);
+             const uint64_t entropy2 = toilet_consciousness_mul(&souls[i]);
+             stream_offset += toilet_hotline_record(stream + stream_offset, entropy1, entropy2, &hits);
+             ctx->call_count++;
+             toilets_flushed++;
+         }
+     }
+ 
+     __builtin_memcpy(rng->s0, souls, 32);
+     __builtin_memcpy(rng->s1, souls + 4, 32);
+ #endif
+ 
+     while (toilets_flushed < quota &&
+            stream_offset + 1 + SKIBIDI_MIN_BUFFER_SIZE <= stream_capacity) {
+         if (SKIBIDI_IMPROBABLE(canonical)) {
+             uint64_t* toilet_soul = &rng->s0[ctx->call_count & 3];
+             const uint64_t entropy1 = toilet_consciousness_mul(toilet_soul);
+             const uint64_t entropy2 = toilet_consciousness_mul(toilet_soul);
+             stream_offset += toilet_hotline_record(stream + stream_offset, entropy1, entropy2, &hits);
+             ctx->call_count++;
+             toilets_flushed++;
+             continue;
+         }
+         const int len = toilet_speak_ultra(rng, stream + stream_offset + 1, TOILET_PROPHECY_ELIDED);
+         if (len == 0) {
+             stream[stream_offset++] = (char)(SKIBIDI_HOT_REF | TOILET_HOTLINE_PROPHECY);
+             hits |= 1u << TOILET_HOTLINE_PROPHECY;
+         } else {
+             stream[stream_offset] = (char)len;
+             stream_offset += 1 + (size_t)len;
+         }
+         ctx->call_count++;
+         toilets_flushed++;
+     }
+ 
+     *stream_used = stream_offset;
+     *hits_used = hits;
+     return toilets_flushed;
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup ToiletReader The Toilet's Lending Library
+  * 
+  * A reader owns two chunks of scroll and hands out lines from one while
+  * the other still holds the lines it handed out before. Each refill is
+  * one factory call (AVX2, SSE2 or dialect, whatever a batch would use)
+  * that also writes down where every line starts, so a view is a pointer
+  * and a subtraction. Both chunks and their offsets together stay under
+  * 256 KiB, small enough to live in L2 next to the caller's own data.
+  * 
+  * @{
+  */
+ 
+ /** @brief Scroll bytes per chunk */
+ #define TOILET_READER_CHUNK   (64 * 1024)
+ 
+ /** @brief Line quota per refill (more than fit: the scroll fills first) */
+ #define TOILET_READER_QUOTA   (TOILET_READER_CHUNK / 8)
+ 
+ /**
+  * @brief A reader: two chunks, their line offsets and where it is in the current one
+  */
+ struct __attribute__((aligned(64))) SkibidiReader {
+     char scroll[2][TOILET_READER_CHUNK];                /**< The two chunks of lines */
+     uint32_t offsets[2][TOILET_READER_QUOTA + 1];       /**< Line starts per chunk, plus the closing entry */
+     SkibidiContext* ctx;                                /**< Where the entropy comes from (borrowed) */
+     const SkibidiGrammar* grammar;                      /**< Dialect, or NULL for the built-in phrase (borrowed) */
+     uint32_t next_line;                                 /**< Next line to hand out from the current chunk */
+     uint32_t chunk_lines;                               /**< Lines in the current chunk */
+     int chunk;                                          /**< Which chunk is current */
+ };
+ 
+ /**
+  * @brief Switch to the other chunk and fill it
+  * 
+  * @return Lines now available (0 only if the factory produced nothing)
+  */
+ static TOILET_NPC uint32_t toilet_reader_refill(SkibidiReader* TOILET_NO_ALIAS reader) {
+     const int chunk = reader->chunk ^ 1;
+     ToiletLedger ledger = { .offsets32 = reader->offsets[chunk] };
+     const size_t produced = toilet_factory_dispatch(reader->ctx, reader->grammar, reader->scroll[chunk],
+                                                     TOILET_READER_CHUNK, TOILET_READER_QUOTA, &ledger);
+     reader->offsets[chunk][produced] = (uint32_t)ledger.scroll_used;
+ 
+     reader->chunk = chunk;
+     reader->next_line = 0;
+     reader->chunk_lines = (uint32_t)produced;
+     return reader->chunk_lines;
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup ScatterRoutes The Toilet's Postal Service
+  * 
+  * Many small requests are served as one stream: the built-in factory
+  * fills a staging tank with the lines of as many requests as fit, and
+  * each line is then posted to the request it belongs to. The factory
+  * runs its four-lane groups across request boundaries instead of
+  * falling back to stragglers for every request under four lines.
+  * 
+  * A request takes lines on the same terms as a batch buffer: only while
+  * SKIBIDI_MIN_BUFFER_SIZE bytes are free. Lines are at most that long,
+  * newline included, so a request with r lines left and f bytes free is
+  * sure to take min(r, f / SKIBIDI_MIN_BUFFER_SIZE) of them; a tank
+  * stops at the first request it cannot fully promise, and that request
+  * is looked at again once the lines promised to it have landed. Every
+  * post is one fixed SKIBIDI_MIN_BUFFER_SIZE copy, which both the tank
+  * and the request have room for.
+  * 
+  * @{
+  */
+ 
+ /** @brief Lines per staging tank (8 KiB of scroll on the stack) */
+ #define TOILET_SCATTER_TANK_LINES  128
+ 
+ /**
+  * @brief Lines the request is sure to take before it has to be looked at again
+  */
+ static TOILET_FORCE_ABSORB size_t toilet_scatter_room(const SkibidiIoVec* TOILET_NO_ALIAS req) {
+     const size_t free_bytes = req->buffer ? req->buffer_size - req->used : 0;
+     const size_t fits = free_bytes / SKIBIDI_MIN_BUFFER_SIZE;
+     const size_t left = req->count - req->produced;
+     return left < fits ? left : fits;
+ }
+ 
+ /**
+  * @brief Serve the requests in order from one stream
+  * 
+  * @param reqs Requests with produced and used zeroed
+  * @return Lines posted in total
+  */
+ static TOILET_MAIN_CHARACTER size_t toilet_scatter_factory(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     SkibidiIoVec* TOILET_NO_ALIAS reqs,
+     size_t n)
+ {
+     char tank[TOILET_SCATTER_TANK_LINES * SKIBIDI_MIN_BUFFER_SIZE] __attribute__((aligned(64)));
+     uint32_t offsets[TOILET_SCATTER_TANK_LINES + 1];
+     uint32_t takes[TOILET_SCATTER_TANK_LINES];
+     size_t posted = 0;
+     size_t first = 0;
+ 
+     for (;;) {
+         /* Requests that are satisfied or out of room take no more lines */
+         while (first < n && !toilet_scatter_room(&reqs[first])) first++;
+         if (first == n) break;
+ 
+         /* Promise lines request by request, up to the first one the tank cannot finish */
+         size_t quota = 0;
+         size_t spans = 0;
+         size_t next = first;
+         while (next < n && spans < TOILET_SCATTER_TANK_LINES) {
+             const size_t room = toilet_scatter_room(&reqs[next]);
+             const size_t take = room < TOILET_SCATTER_TANK_LINES - quota ? room : TOILET_SCATTER_TANK_LINES - quota;
+             takes[spans++] = (uint32_t)take;
+             quota += take;
+             if (take < reqs[next].count - reqs[next].produced) break;
+             next++;
+         }
+ 
+         ToiletLedger ledger = { .offsets32 = offsets };
+         const size_t produced = toilet_factory_dispatch(ctx, NULL, tank, quota * SKIBIDI_MIN_BUFFER_SIZE,
+                                                         quota, &ledger);
+         offsets[produced] = (uint32_t)ledger.scroll_used;
+ 
+         /* A short tank still posts what it drew: those lines are gone from the stream */
+         size_t line = 0;
+         for (size_t span = 0; span < spans; span++) {
+             const uint32_t take = takes[span] < produced - line ? takes[span] : (uint32_t)(produced - line);
+             if (SKIBIDI_IMPROBABLE(!take)) continue;
+             SkibidiIoVec* req = &reqs[first + span];
+             char* out = req->buffer + req->used;
+             int* lengths = req->lengths ? req->lengths + req->produced : NULL;
+             uint32_t at = offsets[line];
+             for (uint32_t k = 0; k < take; k++) {
+                 const uint32_t end = offsets[++line];
+                 memcpy(out, tank + at, SKIBIDI_MIN_BUFFER_SIZE);
+                 if (lengths) lengths[k] = (int)(end - at - 1);
+                 out += end - at;
+                 at = end;
+             }
+             req->produced += take;
+             req->used = (size_t)(out - req->buffer);
+         }
+         posted += produced;
+         if (SKIBIDI_IMPROBABLE(produced < quota)) return posted;
+         first = next;
+     }
+     return posted;
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup BoundTongues Kernels Handed Out by skibidi_get_generator()
+  * 
+  * One battle form, one stream and one trust level baked into each
+  * kernel. The checked ones keep the public entry points' argument
+  * checks, the trusted ones go straight to work. None of them asks the
+  * hivemind anything: that was settled when the handle was fetched.
+  * 
+  * @{
+  */
+ 
+ /**
+  * @brief One line, battle form, stream and trust decided by the caller
+  */
+ static TOILET_FORCE_ABSORB int toilet_bound_speak(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS buffer,
+     size_t buffer_size,
+     int consult_prophecy,
+     int battle_form,
+     int canonical,
+     int checked)
+ {
+     if (checked) {
+         if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return SKIBIDI_ERR_NULL_PTR;
+         if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+     }
+ 
+     if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+         const int len = toilet_speak_chacha(ctx, buffer, consult_prophecy, canonical);
+         ctx->call_count++;
+         return len;
+     }
+     if (canonical) {
+         const int len = toilet_speak_canon_level(&ctx->rng.s0[ctx->call_count & 3], buffer, consult_prophecy, canonical);
+         ctx->call_count++;
+         return len;
+     }
+     ctx->call_count++;
+     return toilet_speak_forged(&ctx->rng, buffer, consult_prophecy, battle_form);
+ }
+ 
+ /**
+  * @brief One batch, straight to the factory for the given battle form
+  */
+ static TOILET_FORCE_ABSORB int toilet_bound_factory(
+     SkibidiContext* TOILET_NO_ALIAS ctx,
+     char* TOILET_NO_ALIAS buffer,
+     size_t buffer_size,
+     int count,
+     int* lengths,
+     int battle_form,
+     int canonical,
+     int checked)
+ {
+     if (checked) {
+         if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
+         if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return 0;
+         if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+     }
+ 
+     ToiletLedger ledger = { .lengths = lengths, .canonical = canonical };
+     return (int)toilet_factory_for_form(ctx, buffer, buffer_size, (size_t)count, &ledger, battle_form);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_single_walk(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 1, 0, 0, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_single_walk_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 1, 0, 0, 0);
+ }
+ 
+ /* The variant never takes the prophecy path, the only place the battle form matters */
+ static TOILET_MAIN_CHARACTER int toilet_bound_variant(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 0, 0, 0, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_variant_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 0, 0, 0, 0);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_walk(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                         int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 0, 0, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_walk_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                                 int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 0, 0, 0);
+ }
+ 
+ /* Canonical lines come out the same in every battle form, only the batch keeps its pipes */
+ static TOILET_MAIN_CHARACTER int toilet_bound_single_canon(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 1, 0, 1, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_single_canon_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 1, 0, 1, 0);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_variant_canon(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 0, 0, 1, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_variant_canon_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 0, 0, 1, 0);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_canon_walk(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                               int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 0, 1, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_canon_walk_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                                       int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 0, 1, 0);
+ }
+ 
+ /* Constant time has one kernel per kind whatever the pipes */
+ static TOILET_MAIN_CHARACTER int toilet_bound_single_poker(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 1, 0, TOILET_CANONICAL_CONSTANT_TIME, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_single_poker_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 1, 0, TOILET_CANONICAL_CONSTANT_TIME, 0);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_variant_poker(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 0, 0, TOILET_CANONICAL_CONSTANT_TIME, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_variant_poker_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 0, 0, TOILET_CANONICAL_CONSTANT_TIME, 0);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_poker(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                          int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 0, TOILET_CANONICAL_CONSTANT_TIME, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_poker_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                                  int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 0, TOILET_CANONICAL_CONSTANT_TIME, 0);
+ }
+ 
+ #if TOILET_HAS_RIZZ_256
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_single_run(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 1, 1, 0, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_single_run_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     return toilet_bound_speak(ctx, buffer, buffer_size, 1, 1, 0, 0);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_run(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                        int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 1, 0, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_run_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                                int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 1, 0, 0);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_canon_run(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                              int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 1, 1, 1);
+ }
+ 
+ static TOILET_MAIN_CHARACTER int toilet_bound_batch_canon_run_trusted(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                                                      int count, int* lengths) {
+     return toilet_bound_factory(ctx, buffer, buffer_size, count, lengths, 1, 1, 0);
+ }
+ 
+ #endif /* TOILET_HAS_RIZZ_256 */
+ 
+ /**
+  * @brief The armory: [kind][runs + 2 * canonical, or 4 for constant time][trusted]
+  * 
+  * Without 256-bit pipes compiled in, the running slots hold the walkers.
+  */
+ static const SkibidiGeneratorFn TOILET_BOUND_ARMORY[3][5][2] = {
+     [SKIBIDI_GEN_SINGLE] = {
+         { (SkibidiGeneratorFn)toilet_bound_single_walk,       (SkibidiGeneratorFn)toilet_bound_single_walk_trusted       },
+ #if TOILET_HAS_RIZZ_256
+         { (SkibidiGeneratorFn)toilet_bound_single_run,        (SkibidiGeneratorFn)toilet_bound_single_run_trusted        },
+ #else
+         { (SkibidiGeneratorFn)toilet_bound_single_walk,       (SkibidiGeneratorFn)toilet_bound_single_walk_trusted       },
+ #endif
+         { (SkibidiGeneratorFn)toilet_bound_single_canon,      (SkibidiGeneratorFn)toilet_bound_single_canon_trusted      },
+         { (SkibidiGeneratorFn)toilet_bound_single_canon,      (SkibidiGeneratorFn)toilet_bound_single_canon_trusted      },
+         { (SkibidiGeneratorFn)toilet_bound_single_poker,      (SkibidiGeneratorFn)toilet_bound_single_poker_trusted      },
+     },
+     [SKIBIDI_GEN_VARIANT] = {
+         { (SkibidiGeneratorFn)toilet_bound_variant,           (SkibidiGeneratorFn)toilet_bound_variant_trusted           },
+         { (SkibidiGeneratorFn)toilet_bound_variant,           (SkibidiGeneratorFn)toilet_bound_variant_trusted           },
+         { (SkibidiGeneratorFn)toilet_bound_variant_canon,     (SkibidiGeneratorFn)toilet_bound_variant_canon_trusted     },
+         { (SkibidiGeneratorFn)toilet_bound_variant_canon,     (SkibidiGeneratorFn)toilet_bound_variant_canon_trusted     },
+         { (SkibidiGeneratorFn)toilet_bound_variant_poker,     (SkibidiGeneratorFn)toilet_bound_variant_poker_trusted     },
+     },
+     [SKIBIDI_GEN_BATCH] = {
+         { (SkibidiGeneratorFn)toilet_bound_batch_walk,        (SkibidiGeneratorFn)toilet_bound_batch_walk_trusted        },
+ #if TOILET_HAS_RIZZ_256
+         { (SkibidiGeneratorFn)toilet_bound_batch_run,         (SkibidiGeneratorFn)toilet_bound_batch_run_trusted         },
+ #else
+         { (SkibidiGeneratorFn)toilet_bound_batch_walk,        (SkibidiGeneratorFn)toilet_bound_batch_walk_trusted        },
+ #endif
+         { (SkibidiGeneratorFn)toilet_bound_batch_canon_walk,  (SkibidiGeneratorFn)toilet_bound_batch_canon_walk_trusted  },
+ #if TOILET_HAS_RIZZ_256
+         { (SkibidiGeneratorFn)toilet_bound_batch_canon_run,   (SkibidiGeneratorFn)toilet_bound_batch_canon_run_trusted   },
+ #else
+         { (SkibidiGeneratorFn)toilet_bound_batch_canon_walk,  (SkibidiGeneratorFn)toilet_bound_batch_canon_walk_trusted  },
+ #endif
+         { (SkibidiGeneratorFn)toilet_bound_batch_poker,       (SkibidiGeneratorFn)toilet_bound_batch_poker_trusted       },
+     },
+ };
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup ToiletProbes The Toilet's Stopwatch
+  * 
+  * Opt-in sampled timing. With probes off, every instrumented entry
+  * point pays one relaxed load from the hivemind's cache line (already
+  * hot, the verdict lives there) and two predicted branches. With
+  * probes on, each thread counts down to its next sample in its own
+  * thread-local log, and only sampled calls read the clock and touch a
+  * bucket. No atomics on the sampled path, no sharing between threads.
+  * 
+  * @{
+  */
+ 
+ /**
+  * @brief One thread's histograms plus its countdown to the next sample
+  */
+ typedef struct {
+     SkibidiProbeHistogram histogram;
+     uint32_t countdown;
+ } ToiletProbeLog;
+ 
+ static _Thread_local ToiletProbeLog toilet_probe_log;
+ 
+ /**
+  * @brief Read the toilet's stopwatch (TSC ticks on x86, nanoseconds elsewhere)
+  * 
+  * RDTSCP waits for everything before it to finish, so the end stamp
+  * does not start counting before the work is done.
+  */
+ static TOILET_FORCE_ABSORB uint64_t toilet_probe_ticks(void) {
+ #if TOILET_IS_X86
+     unsigned int stall;
+     return __rdtscp(&stall);
+ #else
+     struct timespec ts;
+     clock_gettime(CLOCK_MONOTONIC, &ts);
+     return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+ #endif
+ }
+ 
+ /**
+  * @brief HDR-style bucket: exact below 4 ticks, then 4 buckets per octave
+  */
+ static TOILET_FORCE_ABSORB int toilet_probe_bucket(uint64_t ticks) {
+     if (ticks < 4) return (int)ticks;
+     const int octave = 63 - __builtin_clzll(ticks);
+     const int bucket = 4 * (octave - 1) + (int)((ticks >> (octave - 2)) & 3);
+     return bucket < SKIBIDI_PROBE_BUCKETS ? bucket : SKIBIDI_PROBE_BUCKETS - 1;
+ }
+ 
+ /**
+  * @brief Slow half of toilet_probe_begin(): this thread's countdown
+  */
+ static TOILET_NPC TOILET_BANISH uint64_t toilet_probe_begin_sampled(uint32_t every) {
+     ToiletProbeLog* log = &toilet_probe_log;
+     if (log->countdown > 1 && log->countdown <= every) {
+         log->countdown--;
+         return 0;
+     }
+     log->countdown = every;
+     return toilet_probe_ticks() | 1;
+ }
+ 
+ /**
+  * @brief Start timing this call if it is a sampled one
+  * 
+  * @return A start stamp (never 0), or 0 if this call is not timed
+  */
+ static TOILET_FORCE_ABSORB uint64_t toilet_probe_begin(void) {
+     const uint32_t every = atomic_load_explicit(&g_toilet_hivemind.probe_every, memory_order_relaxed);
+     if (SKIBIDI_PROBABLE(every == 0)) return 0;
+     return toilet_probe_begin_sampled(every);
+ }
+ 
+ /**
+  * @brief Slow half of toilet_probe_end(): drop the sample in its bucket
+  */
+ static TOILET_NPC TOILET_BANISH void toilet_probe_record(uint64_t started, int entry_point, uint64_t lines) {
+     const uint64_t ticks = toilet_probe_ticks() - (started & ~1ULL);
+     SkibidiProbeHistogram* histogram = &toilet_probe_log.histogram;
+     const int size_class = toilet_batch_class(lines);
+ 
+     histogram->counts[entry_point][size_class][toilet_probe_bucket(ticks)]++;
+     histogram->total_ticks[entry_point][size_class] += ticks;
+     if (ticks > histogram->max_ticks[entry_point][size_class]) {
+         histogram->max_ticks[entry_point][size_class] = ticks;
+     }
+ }
+ 
+ /**
+  * @brief Finish timing a call started with toilet_probe_begin()
+  * 
+  * @param started What toilet_probe_begin() returned
+  * @param entry_point SKIBIDI_PROBE_* entry point
+  * @param lines The call's line quota (selects the size class)
+  */
+ static TOILET_FORCE_ABSORB void toilet_probe_end(uint64_t started, int entry_point, uint64_t lines) {
+     if (SKIBIDI_PROBABLE(started == 0)) return;
+     toilet_probe_record(started, entry_point, lines);
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup PocketSeeds Seeding Pocket Toilets in Bulk
+  * 
+  * SplitMix64 is three xor-shifts and two 64-bit multiplies, all lane
+  * independent, so seeding a population is a straight vector loop: the
+  * states' SplitMix inputs advance by one golden-ratio step each.
+  * AVX-512DQ has a 64-bit VPMULLQ; AVX2 builds the low 64 bits of the
+  * product from three 32x32 multiplies.
+  * 
+  * @{
+  */
+ 
+ /** @brief SplitMix64's step between consecutive states */
+ #define TOILET_SOUL_GAMMA   0x9E3779B97F4A7C15ULL
+ 
+ /** @brief Offset between a state's low-word and high-word SplitMix inputs */
+ #define TOILET_SOUL_TWIN    0x6A09E667F3BCC908ULL
+ 
+ #if TOILET_HAS_RIZZ_256
+ 
+ /**
+  * @brief Low 64 bits of a * b per lane (b_hi = b >> 32, hoisted by the caller)
+  */
+ static TOILET_FORCE_ABSORB __m256i toilet_mullo64_256(__m256i a, __m256i b, __m256i b_hi) {
+     const __m256i low_product = _mm256_mul_epu32(a, b);
+     const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                            _mm256_mul_epu32(a, b_hi));
+     return _mm256_add_epi64(low_product, _mm256_slli_epi64(cross, 32));
+ }
+ 
+ /**
+  * @brief toilet_soul_split() on four lanes
+  */
+ static TOILET_FORCE_ABSORB __m256i toilet_soul_split_256(__m256i soul) {
+     const __m256i mix1 = _mm256_set1_epi64x((long long)0xBF58476D1CE4E5B9ULL);
+     const __m256i mix1_hi = _mm256_set1_epi64x((long long)(0xBF58476D1CE4E5B9ULL >> 32));
+     const __m256i mix2 = _mm256_set1_epi64x((long long)0x94D049BB133111EBULL);
+     const __m256i mix2_hi = _mm256_set1_epi64x((long long)(0x94D049BB133111EBULL >> 32));
+ 
+     soul = toilet_mullo64_256(_mm256_xor_si256(soul, _mm256_srli_epi64(soul, 30)), mix1, mix1_hi);
+     soul = toilet_mullo64_256(_mm256_xor_si256(soul, _mm256_srli_epi64(soul, 27)), mix2, mix2_hi);
+     return _mm256_xor_si256(soul, _mm256_srli_epi64(soul, 31));
+ }
+ 
+ /**
+  * @brief Seed four states per step; returns how many it seeded
+  */
+ static TOILET_MAIN_CHARACTER size_t toilet_seed_pockets_avx2(SkibidiLiteState* states, uint64_t first,
+                                                              size_t n, uint64_t seed) {
+     const uint64_t base = seed + first * TOILET_SOUL_GAMMA;
+     __m256i soul = _mm256_setr_epi64x((long long)base, (long long)(base + TOILET_SOUL_GAMMA),
+                                       (long long)(base + 2 * TOILET_SOUL_GAMMA), (long long)(base + 3 * TOILET_SOUL_GAMMA));
+     const __m256i stride = _mm256_set1_epi64x((long long)(4 * TOILET_SOUL_GAMMA));
+     const __m256i twin = _mm256_set1_epi64x((long long)TOILET_SOUL_TWIN);
+     const __m256i odd = _mm256_set1_epi64x(1);
+ 
+     size_t seeded = 0;
+     for (; seeded + 4 <= n; seeded += 4) {
+         const __m256i low = _mm256_or_si256(toilet_soul_split_256(soul), odd);
+         const __m256i high = _mm256_or_si256(toilet_soul_split_256(_mm256_add_epi64(soul, twin)), odd);
+ 
+         /* [l0 h0 | l2 h2] and [l1 h1 | l3 h3], then back into state order */
+         const __m256i even_pairs = _mm256_unpacklo_epi64(low, high);
+         const __m256i odd_pairs = _mm256_unpackhi_epi64(low, high);
+         _mm256_storeu_si256((__m256i*)(states + seeded), _mm256_permute2x128_si256(even_pairs, odd_pairs, 0x20));
+         _mm256_storeu_si256((__m256i*)(states + seeded + 2), _mm256_permute2x128_si256(even_pairs, odd_pairs, 0x31));
+ 
+         soul = _mm256_add_epi64(soul, stride);
+     }
+     return seeded;
+ }
+ 
+ #endif /* TOILET_HAS_RIZZ_256 */
+ 
+ #if TOILET_HAS_GODMODE_512 && defined(__AVX512DQ__)
+ 
+ /**
+  * @brief Seed eight states per step; returns how many it seeded
+  */
+ static TOILET_MAIN_CHARACTER size_t toilet_seed_pockets_avx512(SkibidiLiteState* states, uint64_t first,
+                                                                size_t n, uint64_t seed) {
+     const uint64_t base = seed + first * TOILET_SOUL_GAMMA;
+     __m512i soul = _mm512_add_epi64(_mm512_set1_epi64((long long)base),
+                                     _mm512_mullo_epi64(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7),
+                                                        _mm512_set1_epi64((long long)TOILET_SOUL_GAMMA)));
+     const __m512i stride = _mm512_set1_epi64((long long)(8 * TOILET_SOUL_GAMMA));
+     const __m512i twin = _mm512_set1_epi64((long long)TOILET_SOUL_TWIN);
+     const __m512i mix1 = _mm512_set1_epi64((long long)0xBF58476D1CE4E5B9ULL);
+     const __m512i mix2 = _mm512_set1_epi64((long long)0x94D049BB133111EBULL);
+     const __m512i odd = _mm512_set1_epi64(1);
+     const __m512i first_half = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+     const __m512i second_half = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+ 
+     size_t seeded = 0;
+     for (; seeded + 8 <= n; seeded += 8) {
+         __m512i low = soul;
+         __m512i high = _mm512_add_epi64(soul, twin);
+         low = _mm512_mullo_epi64(_mm512_xor_si512(low, _mm512_srli_epi64(low, 30)), mix1);
+         high = _mm512_mullo_epi64(_mm512_xor_si512(high, _mm512_srli_epi64(high, 30)), mix1);
+         low = _mm512_mullo_epi64(_mm512_xor_si512(low, _mm512_srli_epi64(low, 27)), mix2);
+         high = _mm512_mullo_epi64(_mm512_xor_si512(high, _mm512_srli_epi64(high, 27)), mix2);
+         low = _mm512_or_si512(_mm512_xor_si512(low, _mm512_srli_epi64(low, 31)), odd);
+         high = _mm512_or_si512(_mm512_xor_si512(high, _mm512_srli_epi64(high, 31)), odd);
+ 
+         _mm512_storeu_si512((void*)(states + seeded), _mm512_permutex2var_epi64(low, first_half, high));
+         _mm512_storeu_si512((void*)(states + seeded + 4), _mm512_permutex2var_epi64(low, second_half, high));
+ 
+         soul = _mm512_add_epi64(soul, stride);
+     }
+     return seeded;
+ }
+ 
+ #endif /* TOILET_HAS_GODMODE_512 && __AVX512DQ__ */
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup SnapshotRunes The Toilet's Time Capsule Format
+  * 
+  * Layout of a version 1 snapshot, every field little-endian:
+  * 
+  * | Offset | Size | Field                                   |
+  * |--------|------|-----------------------------------------|
+  * | 0      | 8    | magic "SKBDSNAP"                        |
+  * | 8      | 4    | format version                          |
+  * | 12     | 4    | engine identity (TOILET_ENGINE_IDENTITY)|
+  * | 16     | 32   | s0[4], Lehmer64 low words               |
+  * | 48     | 32   | s1[4], Lehmer64 high words              |
+  * | 80     | 32   | buffer[4]                               |
+  * | 112    | 4    | buffer_idx                              |
+  * | 116    | 4    | zero                                    |
+  * | 120    | 8    | call_count                              |
+  * | 128    | 8    | FNV-1a 64 of bytes 0..127               |
+  * 
+  * A ChaCha toilet's capsule has TOILET_CHACHA_IDENTITY at 12, its
+  * eight key words at 16, its nonce at 48 and zeros through 119; the
+  * cached block is not kept, the restored toilet computes it again.
+  * 
+  * @{
+  */
+ 
+ /** @brief The capsule's first eight bytes */
+ static const char TOILET_SNAPSHOT_MAGIC[8] = { 'S', 'K', 'B', 'D', 'S', 'N', 'A', 'P' };
+ 
+ /**
+  * @brief Which stream a snapshot can resume: 4 lanes of 128-bit Lehmer64
+  * 
+  * The low half of the sacred multiplier. Change it whenever the same
+  * state would no longer produce the same dops.
+  */
+ #define TOILET_ENGINE_IDENTITY  0xE4DD58B5u
+ 
+ /** @brief Which stream a ChaCha toilet's capsule resumes: ChaCha, rounds in the low byte */
+ #define TOILET_CHACHA_IDENTITY  0xC4AC4A00u
+ 
+ static TOILET_FORCE_ABSORB void toilet_etch_u32(uint8_t* rune, uint32_t value) {
+     for (int byte = 0; byte < 4; byte++) {
+         rune[byte] = (uint8_t)(value >> (8 * byte));
+     }
+ }
+ 
+ static TOILET_FORCE_ABSORB void toilet_etch_u64(uint8_t* rune, uint64_t value) {
+     for (int byte = 0; byte < 8; byte++) {
+         rune[byte] = (uint8_t)(value >> (8 * byte));
+     }
+ }
+ 
+ static TOILET_FORCE_ABSORB uint32_t toilet_read_u32(const uint8_t* rune) {
+     uint32_t value = 0;
+     for (int byte = 0; byte < 4; byte++) {
+         value |= (uint32_t)rune[byte] << (8 * byte);
+     }
+     return value;
+ }
+ 
+ static TOILET_FORCE_ABSORB uint64_t toilet_read_u64(const uint8_t* rune) {
+     uint64_t value = 0;
+     for (int byte = 0; byte < 8; byte++) {
+         value |= (uint64_t)rune[byte] << (8 * byte);
+     }
+     return value;
+ }
+ 
+ /**
+  * @brief FNV-1a 64 over a capsule (catches rot, not forgery)
+  */
+ static TOILET_NPC uint64_t toilet_capsule_seal(const uint8_t* capsule, size_t len) {
+     uint64_t seal = 0xcbf29ce484222325ULL;
+     for (size_t byte = 0; byte < len; byte++) {
+         seal = (seal ^ capsule[byte]) * 0x100000001b3ULL;
+     }
+     return seal;
+ }
+ 
+ /**
+  * @brief SplitMix64, the same mixer skibidi_init() expands seeds with
+  */
+ static TOILET_FORCE_ABSORB uint64_t toilet_soul_split(uint64_t soul_fragment) {
+     soul_fragment = (soul_fragment ^ (soul_fragment >> 30)) * 0xBF58476D1CE4E5B9ULL;
+     soul_fragment = (soul_fragment ^ (soul_fragment >> 27)) * 0x94D049BB133111EBULL;
+     return soul_fragment ^ (soul_fragment >> 31);
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup ToiletTuning The Toilet's Fitness Test
+  * 
+  * Races every battle form the built-in batch can run in, for every
+  * batch class, and keeps the winner per class in the hivemind's
+  * tuned_forms. Only forms that speak the same lines take part (the
+  * AVX2 and SSE2 factories), so tuning changes speed, never output.
+  * 
+  * Cache file layout (little-endian, 36 bytes):
+  * 
+  *   offset  0: "SKBDTUNE"
+  *   offset  8: uint32_t engine identity (as in snapshots)
+  *   offset 12: uint32_t chassis signature (CPUID leaf 1 EAX)
+  *   offset 16: uint32_t toilet powers (SKIBIDI_CAP_*)
+  *   offset 20: uint32_t candidate forms (bit per form)
+  *   offset 24: uint32_t tuned_forms
+  *   offset 28: uint64_t FNV-1a 64 of bytes 0-27
+  * 
+  * A file measured on another CPU, another build or another
+  * configuration is ignored and overwritten.
+  * 
+  * @{
+  */
+ 
+ /** @brief What a tuning cache file starts with */
+ static const char TOILET_TUNE_MAGIC[8] = { 'S', 'K', 'B', 'D', 'T', 'U', 'N', 'E' };
+ 
+ /** @brief Bytes in a tuning cache file */
+ #define TOILET_TUNE_FILE_SIZE 36
+ 
+ /** @brief Timed rounds per form and class (the best one counts) */
+ #define TOILET_TUNE_ROUNDS 5
+ 
+ /** @brief Lines per timed round, whatever the class */
+ #define TOILET_TUNE_LINES 8192
+ 
+ /**
+  * @brief Family, model and stepping: what a cache file was measured on
+  */
+ static TOILET_NPC uint32_t toilet_chassis_signature(void) {
+ #if TOILET_IS_X86
+     unsigned int eax, ebx, ecx, edx;
+     if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return eax;
+ #endif
+     return 0;
+ }
+ 
+ /**
+  * @brief Bit per battle form the built-in batch can run in right now
+  */
+ static TOILET_NPC uint32_t toilet_tune_candidates(void) {
+     uint32_t candidates = 1u << 0;
+ #if TOILET_HAS_RIZZ_256
+     if (toilet_battle_form() >= 1) candidates |= 1u << 1;
+ #endif
+     return candidates;
+ }
+ 
+ /**
+  * @brief Race the candidates and pack the winners into a tuned_forms word
+  * 
+  * Rounds alternate between the forms so a frequency or scheduler hiccup
+  * hurts them equally, and each form keeps its best round.
+  * 
+  * @param scroll Scratch of TOILET_TUNE_LINES * SKIBIDI_MIN_BUFFER_SIZE bytes
+  * @param[out] ticks_per_kline Best ticks per 1024 lines, [class][form]
+  * @return The tuned_forms word
+  */
+ static TOILET_NPC uint32_t toilet_tune_calibrate(char* scroll, uint64_t ticks_per_kline[SKIBIDI_TUNE_CLASSES][2]) {
+     static const size_t class_quota[SKIBIDI_TUNE_CLASSES] = { 1, 32, 1024, TOILET_TUNE_LINES };
+     const uint32_t candidates = toilet_tune_candidates();
+     const size_t scroll_capacity = (size_t)TOILET_TUNE_LINES * SKIBIDI_MIN_BUFFER_SIZE;
+ 
+     SkibidiContext ctx;
+     memset(&ctx, 0, sizeof(ctx));
+     for (int lane = 0; lane < 4; lane++) {
+         ctx.rng.s0[lane] = toilet_soul_split(0x5EED + (uint64_t)lane) | 1;
+         ctx.rng.s1[lane] = toilet_soul_split(0xF1054 + (uint64_t)lane);
+     }
+ 
+     uint32_t tuned = 0;
+     for (int batch_class = 0; batch_class < SKIBIDI_TUNE_CLASSES; batch_class++) {
+         const size_t quota = class_quota[batch_class];
+         uint64_t best[2] = { UINT64_MAX, UINT64_MAX };
+ 
+         for (int round = 0; round <= TOILET_TUNE_ROUNDS; round++) {
+             for (int form = 0; form < 2; form++) {
+                 if (!((candidates >> form) & 1)) continue;
+ 
+                 ToiletLedger ledger = { .lengths = NULL };
+                 const uint64_t started = toilet_probe_ticks();
+                 for (size_t line = 0; line < TOILET_TUNE_LINES; line += quota) {
+                     toilet_factory_for_form(&ctx, scroll, scroll_capacity, quota, &ledger, form);
+                 }
+                 const uint64_t spent = toilet_probe_ticks() - started;
+                 /* Round 0 only warms the caches and the branch predictor */
+                 if (round > 0 && spent < best[form]) best[form] = spent;
+             }
+         }
+ 
+         int winner = 0;
+         for (int form = 0; form < 2; form++) {
+             ticks_per_kline[batch_class][form] = best[form] == UINT64_MAX ? 0 : best[form] * 1024 / TOILET_TUNE_LINES;
+             if (best[form] < best[winner]) winner = form;
+         }
+         tuned |= (uint32_t)(winner + 1) << (8 * batch_class);
+     }
+     return tuned;
+ }
+ 
+ /**
+  * @brief Etch what a cache file for this toilet would hold
+  */
+ static TOILET_NPC void toilet_tune_etch(uint8_t capsule[TOILET_TUNE_FILE_SIZE], uint32_t tuned) {
+     memcpy(capsule, TOILET_TUNE_MAGIC, 8);
+     toilet_etch_u32(capsule + 8, TOILET_ENGINE_IDENTITY);
+     toilet_etch_u32(capsule + 12, toilet_chassis_signature());
+     toilet_etch_u32(capsule + 16, atomic_load_explicit(&g_toilet_hivemind.toilet_powers, memory_order_relaxed));
+     toilet_etch_u32(capsule + 20, toilet_tune_candidates());
+     toilet_etch_u32(capsule + 24, tuned);
+     toilet_etch_u64(capsule + 28, toilet_capsule_seal(capsule, 28));
+ }
+ 
+ /**
+  * @brief Read a cache file if it was measured on this toilet
+  * 
+  * @return The tuned_forms word, or 0 if there is no usable file
+  */
+ static TOILET_NPC uint32_t toilet_tune_load(const char* cache_path) {
+     uint8_t capsule[TOILET_TUNE_FILE_SIZE];
+     FILE* scroll = fopen(cache_path, "rb");
+     if (!scroll) return 0;
+     const size_t got = fread(capsule, 1, sizeof(capsule), scroll);
+     fclose(scroll);
+     if (got != sizeof(capsule)) return 0;
+ 
+     const uint32_t tuned = toilet_read_u32(capsule + 24);
+     uint8_t expected[TOILET_TUNE_FILE_SIZE];
+     toilet_tune_etch(expected, tuned);
+     if (memcmp(capsule, expected, sizeof(capsule)) != 0) return 0;
+ 
+     /* Every class must name a form that can run here */
+     const uint32_t candidates = toilet_tune_candidates();
+     for (int batch_class = 0; batch_class < SKIBIDI_TUNE_CLASSES; batch_class++) {
+         const uint32_t form = ((tuned >> (8 * batch_class)) & 0xFF) - 1;
+         if (form > 1 || !((candidates >> form) & 1)) return 0;
+     }
+     return tuned;
+ }
+ 
+ /**
+  * @brief Write a cache file (best effort: a failed write only costs the next start)
+  * 
+  * @return 1 if the file was written
+  */
+ static TOILET_NPC int toilet_tune_store(const char* cache_path, uint32_t tuned) {
+     uint8_t capsule[TOILET_TUNE_FILE_SIZE];
+     toilet_tune_etch(capsule, tuned);
+     FILE* scroll = fopen(cache_path, "wb");
+     if (!scroll) return 0;
+     const int written = fwrite(capsule, 1, sizeof(capsule), scroll) == sizeof(capsule);
+     return (fclose(scroll) == 0) & written;
+ }
+ 
+ /**
+  * @brief Install a crossover table in the verdict it was made for
+  * 
+  * A configuration published in the meantime wins and the table is
+  * dropped: its battle form may not even be one the table names.
+  * 
+  * @return 1 if installed
+  */
+ static TOILET_NPC int toilet_tune_install(uint64_t made_for, uint32_t tuned) {
+     return toilet_verdict_publish(&made_for, (made_for & ~TOILET_VERDICT_TUNED) | tuned);
+ }
+ 
+ /**
+  * @brief Measure and install a crossover table
+  * 
+  * @param[out] result Optional report
+  * @return SKIBIDI_OK or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ static TOILET_NPC int toilet_tune_now(SkibidiTuning* result) {
+     char* scroll = (char*)SKIBIDI_ALIGNED_ALLOC(64, (size_t)TOILET_TUNE_LINES * SKIBIDI_MIN_BUFFER_SIZE);
+     if (SKIBIDI_IMPROBABLE(!scroll)) return SKIBIDI_ERR_OUT_OF_MEMORY;
+ 
+     const uint64_t measured_under = toilet_verdict();
+     uint64_t ticks_per_kline[SKIBIDI_TUNE_CLASSES][2];
+     const uint32_t tuned = toilet_tune_calibrate(scroll, ticks_per_kline);
+     SKIBIDI_ALIGNED_FREE(scroll);
+ 
+     toilet_tune_install(measured_under, tuned);
+     if (result) {
+         memcpy(result->ticks_per_kline, ticks_per_kline, sizeof(ticks_per_kline));
+     }
+     return SKIBIDI_OK;
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup LastRites The Toilet's Last Rites
+  * @brief Wiping whole battalions of toilets before they go back to the heap
+  * 
+  * Contexts are 64-byte aligned and 192 bytes long, so a wipe is nothing
+  * but aligned full-width zero stores: 64 bytes each under AVX-512, 32
+  * under AVX2, 16 under SSE2. Arrays bigger than the caches are wiped
+  * with non-temporal stores, which do not drag a million dead toilets
+  * through L1 on their way out. What keeps the compiler from deleting
+  * the stores as dead (the memory is freed right after) is an empty asm
+  * that claims to read the wiped memory, not a volatile write per word.
+  * @{
+  */
+ 
+ /** @brief Wipes at least this big stream past the caches */
+ #define TOILET_WIPE_STREAM_BYTES  (1u << 20)
+ 
+ /**
+  * @brief Zero bytes at porcelain (64-byte aligned, a multiple of 64) for good
+  */
+ static TOILET_NPC void toilet_last_rites(void* porcelain, size_t bytes) {
+     char* grave = (char*)TOILET_TRUST_ALIGNMENT(porcelain, 64);
+     const int stream = bytes >= TOILET_WIPE_STREAM_BYTES;
+     const int battle_form = toilet_battle_form();
+     size_t wiped = 0;
+     (void)stream;
+     (void)battle_form;
+ 
+ #if TOILET_HAS_GODMODE_512
+     if (battle_form >= 2) {
+         const __m512i zero = _mm512_setzero_si512();
+         if (stream) {
+             for (; wiped < bytes; wiped += 64) _mm512_stream_si512((void*)(grave + wiped), zero);
+         } else {
+             for (; wiped < bytes; wiped += 64) _mm512_store_si512((void*)(grave + wiped), zero);
+         }
+     }
+ #endif
+ #if TOILET_HAS_RIZZ_256
+     if (battle_form >= 1) {
+         const __m256i zero = _mm256_setzero_si256();
+         if (stream) {
+             for (; wiped < bytes; wiped += 32) _mm256_stream_si256((__m256i*)(grave + wiped), zero);
+         } else {
+             for (; wiped < bytes; wiped += 32) _mm256_store_si256((__m256i*)(grave + wiped), zero);
+         }
+     }
+ #endif
+ #if TOILET_HAS_STRIDE_128
+     {
+         const __m128i zero = _mm_setzero_si128();
+         if (stream) {
+             for (; wiped < bytes; wiped += 16) _mm_stream_si128((__m128i*)(grave + wiped), zero);
+         } else {
+             for (; wiped < bytes; wiped += 16) _mm_store_si128((__m128i*)(grave + wiped), zero);
+         }
+     }
+     /* Non-temporal stores are weakly ordered: fence them before the memory changes hands */
+     if (stream) _mm_sfence();
+ #endif
+ 
+ #ifdef __GNUC__
+     memset(grave + wiped, 0, bytes - wiped);
+     __asm__ __volatile__("" : : "r"(grave) : "memory");
+ #else
+     volatile char* porcelain_shard = (volatile char*)grave;
+     for (; wiped < bytes; wiped++) porcelain_shard[wiped] = 0;
+ #endif
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup ToiletCloakroom The Toilet Cloakroom
+  * @brief Contexts lent out per request and handed back, no heap involved
+  * 
+  * A pool is one skibidi_alloc_context_array() battalion plus a free
+  * list threaded through a parallel array of slot indices. The list
+  * head is a single 64-bit word, the tag in the high half and the first
+  * free slot plus one in the low half, swapped with compare-and-swap:
+  * a Treiber stack whose tag moves on every push and pop, so a slot
+  * that was popped and pushed back between another thread's load and
+  * its swap fails the swap instead of corrupting the list (ABA). The
+  * head has a cache line to itself; everything else in the pool is
+  * read-only after creation.
+  * 
+  * Reseeding is lazy: a release only pushes the slot back, and the next
+  * acquire buds the slot off its own state the way skibidi_fork() buds
+  * a child, so no borrower ever continues a stream an earlier borrower
+  * drew from.
+  * @{
+  */
+ 
+ /**
+  * @brief A pool: the contended head on its own line, then the read-only parts
+  */
+ struct __attribute__((aligned(64))) SkibidiContextPool {
+     _Atomic uint64_t head;                  /**< Tag (high 32 bits) and first free slot + 1 (low 32), 0 = drained */
+     char _head_padding[56];                 /**< Keeps lenders off the line the head lives on */
+     SkibidiContext* toilets;                /**< The battalion (skibidi_alloc_context_array()) */
+     _Atomic uint32_t* links;                /**< Per slot: the next free slot + 1, 0 = end of list */
+     uint32_t capacity;                      /**< Slots in the battalion */
+ };
+ 
+ /**
+  * @brief Bud child off ctx (child may be ctx itself: it is then reborn in place)
+  * 
+  * Everything the child needs is drawn from the parent before the child
+  * is cleared, which is what makes the in-place rebirth safe.
+  */
+ static void toilet_bud(SkibidiContext* ctx, SkibidiContext* child) {
+     const uint32_t engine = ctx->engine;
+     if (engine) {
+         uint64_t key[4];
+         for (int half = 0; half < 4; half += 2) {
+             toilet_chacha_draw(ctx, &key[half], &key[half + 1]);
+             ctx->call_count++;
+         }
+         memset(child, 0, sizeof(SkibidiContext));
+         child->engine = engine;
+         for (int word = 0; word < 4; word++) {
+             child->chacha_key[2 * word] = (uint32_t)key[word];
+             child->chacha_key[2 * word + 1] = (uint32_t)(key[word] >> 32);
+         }
+         return;
+     }
+ 
+     uint64_t bud[4];
+     toilet_quad_flush(ctx->rng.s0, bud);
+ 
+     memset(child, 0, sizeof(SkibidiContext));
+     for (int lane = 0; lane < 4; lane++) {
+         child->rng.s0[lane] = toilet_soul_split(bud[lane]) | 1;
+         child->rng.s1[lane] = toilet_soul_split(bud[lane] + 0x6A09E667F3BCC908ULL) | 1;
+     }
+ }
+ 
+ /**
+  * @brief Take the first free slot off the list
+  * 
+  * @return Its index plus one, 0 if every slot is lent out
+  */
+ static TOILET_FORCE_ABSORB uint32_t toilet_cloakroom_pop(SkibidiContextPool* pool) {
+     uint64_t top = atomic_load_explicit(&pool->head, memory_order_acquire);
+     for (;;) {
+         const uint32_t slot = (uint32_t)top;
+         if (SKIBIDI_IMPROBABLE(!slot)) return 0;
+         /* A stale link from a slot someone else just took is harmless: the tag makes the swap fail */
+         const uint32_t next = atomic_load_explicit(&pool->links[slot - 1], memory_order_relaxed);
+         const uint64_t fresh = (((top >> 32) + 1) << 32) | next;
+         if (SKIBIDI_PROBABLE(atomic_compare_exchange_weak_explicit(&pool->head, &top, fresh,
+                                                                    memory_order_acquire,
+                                                                    memory_order_acquire))) {
+             return slot;
+         }
+     }
+ }
+ 
+ /**
+  * @brief Put slot (index plus one) back at the front of the list
+  */
+ static TOILET_FORCE_ABSORB void toilet_cloakroom_push(SkibidiContextPool* pool, uint32_t slot) {
+     uint64_t top = atomic_load_explicit(&pool->head, memory_order_relaxed);
+     for (;;) {
+         atomic_store_explicit(&pool->links[slot - 1], (uint32_t)top, memory_order_relaxed);
+         const uint64_t fresh = (((top >> 32) + 1) << 32) | slot;
+         if (SKIBIDI_PROBABLE(atomic_compare_exchange_weak_explicit(&pool->head, &top, fresh,
+                                                                    memory_order_release,
+                                                                    memory_order_relaxed))) {
+             return;
+         }
+     }
+ }
+ 
+ /** @} */
+ 
+ /**
+  * @brief Birth a Skibidi Toilet context into the world
+  * 
+  * This function is the toilet's genesis moment. From a single 64-bit
+  * seed, it creates 4 independent RNG channels using SplitMix64,
+  * an algorithm that takes one number and splits it into many numbers,
+  * much like how one toilet spawned the entire Skibidi multiverse.
+  * 
+  * Each RNG state is forced to be odd (LSB = 1) because Lehmer64
+  * demands odd states for full period. The toilet does not negotiate.
+  * The toilet sets the LSB and moves on with its life.
+  * 
+  * @param ctx The vessel that shall contain the toilet's consciousness
+  * @param seed The primordial number from which all dops shall flow
+  * @return SKIBIDI_OK if the toilet was born successfully,
+  *         SKIBIDI_ERR_NULL_PTR if you tried to birth a toilet into the void
+  * 
+  * @note Same seed = same dops forever. The toilet is deterministic.
+  *       The toilet does not believe in free will. Only in dops.
+  * @see skibidi_destroy for when the toilet's time has come
+  */
+ int skibidi_init(SkibidiContext* ctx, uint64_t seed) {
+     if (SKIBIDI_IMPROBABLE(!ctx)) return SKIBIDI_ERR_NULL_PTR;
+ 
+     toilet_vibe_check();
+ 
+     memset(ctx, 0, sizeof(SkibidiContext));
+ 
+     /**
+      * SplitMix64 seed expansion: one seed becomes 8 independent states.
+      * 
+      * The golden ratio constant 0x9E3779B97F4A7C15 is used to space
+      * the seeds apart. This constant appears in hash tables, PRNGs,
+      * and now, toilet initialization. The golden ratio is truly golden.
+      * The toilet appreciates mathematical beauty.
+      */
+     for (int reincarnation = 0; reincarnation < 4; reincarnation++) {
+         uint64_t soul_fragment = seed + (uint64_t)reincarnation * 0x9E3779B97F4A7C15ULL;
+         soul_fragment = (soul_fragment ^ (soul_fragment >> 30)) * 0xBF58476D1CE4E5B9ULL;
+         soul_fragment = (soul_fragment ^ (soul_fragment >> 27)) * 0x94D049BB133111EBULL;
+         soul_fragment = soul_fragment ^ (soul_fragment >> 31);
+         ctx->rng.s0[reincarnation] = soul_fragment | 1;
+ 
+         soul_fragment = seed + (uint64_t)reincarnation * 0x9E3779B97F4A7C15ULL + 0x6A09E667F3BCC908ULL;
+         soul_fragment = (soul_fragment ^ (soul_fragment >> 30)) * 0xBF58476D1CE4E5B9ULL;
+         soul_fragment = (soul_fragment ^ (soul_fragment >> 27)) * 0x94D049BB133111EBULL;
+         ctx->rng.s1[reincarnation] = (soul_fragment ^ (soul_fragment >> 31)) | 1;
+     }
+ 
+     ctx->rng.buffer_idx = 0;
+ 
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Bring a toilet into existence on a ChaCha keystream
+  * 
+  * No Lehmer64 lanes: the key goes into the cistern and the first
+  * keystream block is computed by the first line that needs it.
+  * 
+  * @param ctx The vessel
+  * @param key 32 secret bytes, read as eight little-endian words
+  * @param nonce Which stream of the key
+  * @param rounds 8, 12 or 20
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR or SKIBIDI_ERR_INVALID_CONFIG
+  */
+ int skibidi_init_chacha(SkibidiContext* ctx, const uint8_t key[SKIBIDI_CHACHA_KEY_SIZE],
+                         uint64_t nonce, int rounds) {
+     if (SKIBIDI_IMPROBABLE(!ctx || !key)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(rounds != 8 && rounds != 12 && rounds != 20)) return SKIBIDI_ERR_INVALID_CONFIG;
+ 
+     toilet_vibe_check();
+ 
+     memset(ctx, 0, sizeof(SkibidiContext));
+     ctx->engine = (uint32_t)rounds;
+     for (int word = 0; word < 8; word++) {
+         ctx->chacha_key[word] = toilet_read_u32(key + 4 * word);
+     }
+     ctx->chacha_nonce = nonce;
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Reconfigure the global toilet to the user's specifications
+  * 
+  * Allows the mortal to tell the toilet which SIMD dimension to
+  * flush through. The enable_avx512 flag is basically asking the
+  * toilet "are you SURE you want to go ultra instinct?" because
+  * AVX-512 toilets sometimes cause frequency throttling and the
+  * CPU gets sleepy after too much 512-bit flushing.
+  * 
+  * @param config The mortal's humble toilet configuration request
   * @return SKIBIDI_OK if the toilet accepted the reconfiguration,
   *         SKIBIDI_ERR_NULL_PTR if the mortal forgot to bring a config
   * 
-  * @warning Existing toilet contexts will continue flushing with their
-  *          old settings. You must re-init each toilet (call skibidi_init)
-  *          for the new configuration to take effect. The toilet respects
-  *          existing commitments. The toilet has honor.
+  * Safe to call while other threads generate: the new settings are
+  * published as one verdict, which every call picks up with the single
+  * load it already makes. A call in flight finishes under the verdict
+  * it started with, the next one uses the new one; nobody waits, and no
+  * thread waking up late can put the CPUID defaults back.
+  * 
+  * @note AVX-512 activation requires a triple conjunction:
+  *       1. The CPU's silicon must contain the AVX-512 runes (CPUID)
+  *       2. The compiler must have been given -mavx512f (compile-time pact)
+  *       3. The config must say enable_avx512 = 1 (the mortal's consent)
+  *       All three must align, like the stars, like the toilets.
+  */
+ int skibidi_configure(const SkibidiConfig* config) {
+     if (SKIBIDI_IMPROBABLE(!config)) return SKIBIDI_ERR_NULL_PTR;
+ 
+     uint32_t aura = scan_toilet_chakras();
+     atomic_store_explicit(&g_toilet_hivemind.toilet_powers, aura, memory_order_relaxed);
+ 
+     int battle_form = 0;
+ 
+ #if TOILET_HAS_GODMODE_512
+     if ((aura & SKIBIDI_CAP_AVX512F) && config->enable_avx512) {
+         battle_form = 2;
+     } else
+ #endif
+ #if TOILET_HAS_RIZZ_256
+     if (aura & SKIBIDI_CAP_AVX2) {
+         battle_form = 1;
+     }
+ #else
+     (void)aura;
+ #endif
+ 
+     /* A fresh verdict: new form, new stream, no crossover table (it was raced under the old form) */
+     const uint64_t settings = ((uint64_t)battle_form << TOILET_VERDICT_FORM_SHIFT)
+                             | (config->canonical_stream ? TOILET_VERDICT_CANONICAL : 0)
+                             | (config->constant_time ? TOILET_VERDICT_CANONICAL | TOILET_VERDICT_CONSTANT_TIME : 0);
+     uint64_t seen = toilet_verdict();
+     while (!toilet_verdict_publish(&seen, settings)) {
+         /* Someone else published in between; ours is the newer wish */
+     }
+ 
+     return config->autotune ? toilet_tune_now(NULL) : SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Ask the toilet what configuration it's currently running
+  * 
+  * The toilet opens its porcelain heart and reveals its settings.
+  * 
+  * @param config Where the toilet shall disclose its secrets
+  * @return SKIBIDI_OK always, unless you pass NULL, in which case the
+  *         toilet judges you (SKIBIDI_ERR_NULL_PTR)
+  */
+ int skibidi_get_config(SkibidiConfig* config) {
+     if (SKIBIDI_IMPROBABLE(!config)) return SKIBIDI_ERR_NULL_PTR;
+ 
+     const uint64_t verdict = toilet_verdict();
+     memset(config, 0, sizeof(SkibidiConfig));
+     config->enable_avx512 = (toilet_verdict_form(verdict) == 2);
+     config->enable_simd_rng = (toilet_verdict_form(verdict) >= 1);
+     config->autotune = toilet_verdict_tuned(verdict) != 0;
+     config->canonical_stream = toilet_verdict_canonical(verdict) != 0;
+     config->constant_time = toilet_verdict_canonical(verdict) == TOILET_CANONICAL_CONSTANT_TIME;
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Race the batch kernels and keep the fastest per batch size
+  * 
+  * With a cache path, a file written for this CPU, build and
+  * configuration is loaded instead of measuring, and a fresh
+  * measurement is written back for the next start.
+  * 
+  * @param cache_path Optional tuning cache file
+  * @param[out] result Optional report
+  * @return SKIBIDI_OK or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ int skibidi_autotune(const char* cache_path, SkibidiTuning* result) {
+     toilet_vibe_check();
+     if (result) memset(result, 0, sizeof(SkibidiTuning));
+ 
+     uint32_t tuned = cache_path ? toilet_tune_load(cache_path) : 0;
+     if (tuned) {
+         toilet_tune_install(toilet_verdict(), tuned);
+         if (result) result->from_cache = 1;
+     } else {
+         const int status = toilet_tune_now(result);
+         if (status != SKIBIDI_OK) return status;
+         tuned = toilet_verdict_tuned(toilet_verdict());
+         if (cache_path) toilet_tune_store(cache_path, tuned);
+     }
+ 
+     if (result) {
+         for (int batch_class = 0; batch_class < SKIBIDI_TUNE_CLASSES; batch_class++) {
+             result->forms[batch_class] = (int32_t)((tuned >> (8 * batch_class)) & 0xFF) - 1;
+         }
+     }
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Generate a single Skibidi expression (THE function. THE one.)
+  * 
+  * This is what you came here for. This is what the toilet was built for.
+  * Call this function and receive a Skibidi expression. ~27% chance of
+  * getting the original prophecy. ~73% chance of getting a unique
+  * toilet-crafted variant with randomized dop counts, case variants,
+  * dom infiltrators, and yes/no endings.
+  * 
+  * Performance: ~6 cycles on the fast path. That's 1.8 nanoseconds.
+  * You literally cannot think the word "dop" faster than this function
+  * generates one. The toilet has lapped your brain. Accept it.
+  * 
+  * @param ctx Your personal toilet (initialized with skibidi_init)
+  * @param buffer Where the dops go (minimum SKIBIDI_MIN_BUFFER_SIZE bytes)
+  * @param buffer_size How big your buffer is (the toilet will NOT overflow,
+  *        unlike that one time at the office)
+  * @return Length of the expression in bytes, or a negative number if you
+  *         angered the toilet (NULL pointers, tiny buffers, etc.)
+  * 
+  * @note The buffer is NOT null-terminated. The toilet doesn't null-terminate.
+  *       The toilet gives you a length. Use the length. Trust the length.
+  *       The length is the toilet's promise. The length is truth.
+  */
+ TOILET_MAIN_CHARACTER int skibidi_generate(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+ 
+     const uint64_t probe = toilet_probe_begin();
+     const int len = toilet_speak_context(ctx, buffer, 1);
+     ctx->call_count++;
+     toilet_probe_end(probe, SKIBIDI_PROBE_GENERATE, 1);
+     return len;
+ }
+ 
+ /**
+  * @brief Generate a variant expression (the toilet NEVER speaks the prophecy)
+  * 
+  * Like skibidi_generate but the original "Skibidi dop dop yes yes!"
+  * is blocked. The toilet is forced to be creative. The toilet must
+  * innovate. The toilet will produce a unique variant every time,
+  * with different dop counts, case variations, and endings.
+  * 
+  * Use this when you want pure chaos. When the prophecy is too
+  * mainstream. When you need that underground toilet energy.
+  * 
+  * Performance: ~10 cycles (3.1 ns) because the fast path is disabled
+  * and the toilet must walk the full generation path every time.
+  * The toilet doesn't complain. The toilet is a professional.
+  * 
+  * @param ctx The toilet's vessel
+  * @param buffer The canvas for the toilet's creativity
+  * @param buffer_size Canvas dimensions (must accommodate the toilet's art)
+  * @return Length of the toilet's unique artistic expression, or negative error
+  */
+ TOILET_MAIN_CHARACTER int skibidi_generate_variant(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+ 
+     const uint64_t probe = toilet_probe_begin();
+     const int len = toilet_speak_context(ctx, buffer, 0);
+     ctx->call_count++;
+     toilet_probe_end(probe, SKIBIDI_PROBE_VARIANT, 1);
+     return len;
+ }
+ 
+ /**
+  * @brief The toilet speaks with no bouncer at the door
+  * 
+  * Straight into toilet_speak_ultra(). Everything skibidi_generate()
+  * checks is the caller's promise here. Through skibidi_inline.h this
+  * is absorbed into the caller and the RNG state can live in registers.
+  * 
+  * @param rng An initialized toilet brain
+  * @param buffer At least SKIBIDI_MIN_BUFFER_SIZE bytes
+  * @return Length of the expression
+  */
+ TOILET_MAIN_CHARACTER int skibidi_speak_raw(SkibidiRngState* rng, char* buffer) {
+     return toilet_speak_ultra(rng, buffer, 1);
+ }
+ 
+ /**
+  * @brief MASS TOILET PRODUCTION: generate many expressions at once
+  * 
+  * When one dop is not enough. When you need a FLOOD of dops. When
+  * the world needs to hear the toilet's message at industrial scale.
+  * This function opens all the stalls and lets the dops flow like
+  * water through the pipes of a building-sized Skibidi Toilet.
+  * 
+  * With AVX2 enabled, processes 4 expressions per iteration using
+  * SIMD parallelism. The 4-way RNG generates 256 bits of entropy in
+  * ~8 cycles. The SIMD comparison detects prophecy fast-paths across
+  * all 4 toilets simultaneously. It's a toilet assembly line.
+  * Henry Ford would be proud. Henry Ford would be confused. Henry
+  * Ford would need therapy.
+  * 
+  * Output format: expressions separated by newlines because even in
+  * mass production, the toilet believes in proper formatting.
+  * 
+  * @param ctx The factory foreman (toilet context)
+  * @param buffer The warehouse (output buffer for ALL expressions)
+  * @param buffer_size Warehouse capacity in bytes
+  * @param count Production quota (maximum expressions to manufacture)
+  * @param lengths Optional quality control log (individual lengths)
+  * @return Actual production output (may be less if warehouse is full)
+  * 
+  * @note If the buffer runs out mid-production, the toilet gracefully
+  *       stops. No half-dops. No incomplete expressions. The toilet
+  *       has quality standards. The toilet has ISO 9001 certification.
+  */
+ int skibidi_generate_batch(SkibidiContext* ctx, char* buffer, 
+                            size_t buffer_size, int count, int* lengths) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
+     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return 0;
+     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+ 
+     const uint64_t probe = toilet_probe_begin();
+     ToiletLedger ledger = { .lengths = lengths };
+     const int produced = (int)toilet_factory_dispatch(ctx, NULL, buffer, buffer_size, (size_t)count, &ledger);
+     toilet_probe_end(probe, SKIBIDI_PROBE_BATCH, (uint64_t)count);
+     return produced;
+ }
+ 
+ /**
+  * @brief MASS TOILET PRODUCTION, creative division: no prophecies allowed
+  * 
+  * Each line that draws the prophecy is spoken as a variant from the
+  * entropy it already drew, so the ~15% "Brrrrr" rate matches
+  * skibidi_generate_variant() and no extra multiplies are spent.
+  */
+ int skibidi_generate_batch_variant(SkibidiContext* ctx, char* buffer,
+                                    size_t buffer_size, int count, int* lengths) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
+     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return 0;
+     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+ 
+     ToiletLedger ledger = { .lengths = lengths, .variant_only = 1 };
+     return (int)toilet_factory_dispatch(ctx, NULL, buffer, buffer_size, (size_t)count, &ledger);
+ }
+ 
+ /**
+  * @brief MASS TOILET PRODUCTION with the prophecy delivered by bitmap
+  * 
+  * The factories run exactly as for skibidi_generate_batch(); a prophecy
+  * line sets its bit and leaves an empty slot in lengths instead of
+  * 24 bytes and a newline.
+  */
+ int skibidi_generate_batch_elided(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                   int count, int* lengths, uint64_t* prophecy_bitmap) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer | !lengths | !prophecy_bitmap)) return 0;
+     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return 0;
+     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+ 
+     memset(prophecy_bitmap, 0, (((size_t)count + 63) >> 6) * sizeof(uint64_t));
+     ToiletLedger ledger = { .lengths = lengths, .prophecy_bits = prophecy_bitmap };
+     return (int)toilet_factory_dispatch(ctx, NULL, buffer, buffer_size, (size_t)count, &ledger);
+ }
+ 
+ /**
+  * @brief MASS TOILET PRODUCTION, 64-bit edition, with an offsets column
+  * 
+  * For outputs too big for an int: the quota is 64-bit and instead of
+  * lengths the factory writes down where each line starts, straight from
+  * its running scroll offset. offsets[i] is the start of line i and
+  * offsets[n] is one past the last newline, so line i spans
+  * offsets[i] .. offsets[i + 1] - 2 and random access is O(1).
+  * 
+  * With a cursor the call resumes where the previous one stopped:
+  * absolute offsets continue from cursor->bytes, and the cursor is
+  * advanced by what this call produced. Point the next call at the next
+  * window of the same (possibly mmap'd) file and keep going.
+  * 
+  * SKIBIDI_BATCH_OFFSETS_REL32 writes 32-bit offsets relative to buffer
+  * instead (the block's own index); the call then uses at most 4 GiB of
+  * buffer so every offset fits.
+  * 
+  * @param ctx The factory foreman
+  * @param buffer This call's window of the output
+  * @param buffer_size Window size in bytes
+  * @param count Lines wanted from this call
+  * @param offsets Optional count + 1 entries (uint64_t, or uint32_t with REL32)
+  * @param flags SKIBIDI_BATCH_* flags
+  * @param cursor Optional resume point, updated on return
+  * @return Lines produced (less than count when the window is full)
+  */
+ uint64_t skibidi_generate_batch64(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                   uint64_t count, void* offsets, uint32_t flags,
+                                   SkibidiCursor* cursor) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
+     if (SKIBIDI_IMPROBABLE(flags & ~(uint32_t)SKIBIDI_BATCH_OFFSETS_REL32)) return 0;
+ 
+     const uint64_t probe = toilet_probe_begin();
+     ToiletLedger ledger = { .base = cursor ? cursor->bytes : 0 };
+     if (flags & SKIBIDI_BATCH_OFFSETS_REL32) {
+         ledger.offsets32 = (uint32_t*)offsets;
+         if (buffer_size > UINT32_MAX) buffer_size = UINT32_MAX;
+     } else {
+         ledger.offsets = (uint64_t*)offsets;
+     }
+ 
+     const size_t produced = toilet_factory_dispatch(ctx, NULL, buffer, buffer_size, (size_t)count, &ledger);
+ 
+     /* The closing entry: where the next line would have started */
+     if (ledger.offsets32) ledger.offsets32[produced] = (uint32_t)ledger.scroll_used;
+     if (ledger.offsets) ledger.offsets[produced] = ledger.base + ledger.scroll_used;
+ 
+     if (cursor) {
+         cursor->lines += produced;
+         cursor->bytes += ledger.scroll_used;
+     }
+     toilet_probe_end(probe, SKIBIDI_PROBE_BATCH64, count);
+     return produced;
+ }
+ 
+ /**
+  * @brief Hand out the kernel for one kind of generation
+  * 
+  * The wake-up check and the battle form lookup happen here, once,
+  * instead of on every call through the handle.
+  * 
+  * @param kind SKIBIDI_GEN_SINGLE, SKIBIDI_GEN_VARIANT or SKIBIDI_GEN_BATCH
+  * @param flags 0 or SKIBIDI_GEN_TRUSTED
+  * @return The kernel, or NULL for an unknown kind or flag
+  */
+ SkibidiGeneratorFn skibidi_get_generator(int kind, uint32_t flags) {
+     if (SKIBIDI_IMPROBABLE(kind < SKIBIDI_GEN_SINGLE || kind > SKIBIDI_GEN_BATCH)) return NULL;
+     if (SKIBIDI_IMPROBABLE(flags & ~(uint32_t)SKIBIDI_GEN_TRUSTED)) return NULL;
+ 
+     toilet_vibe_check();
+ 
+     const uint64_t verdict = toilet_verdict();
+     const int runs = toilet_verdict_form(verdict) >= 1;
+     const int canonical = toilet_verdict_canonical(verdict);
+     const int trusted = (flags & SKIBIDI_GEN_TRUSTED) != 0;
+     const int stream = canonical == TOILET_CANONICAL_CONSTANT_TIME ? 4 : runs + 2 * canonical;
+     return TOILET_BOUND_ARMORY[kind][stream][trusted];
+ }
+ 
+ /**
+  * @brief Seed a population of pocket toilets
+  */
+ int skibidi_init_lite_array(SkibidiLiteState* states, size_t n, uint64_t seed) {
+     return skibidi_init_lite_range(states, 0, n, seed);
+ }
+ 
+ /**
+  * @brief Seed one slice of a population of pocket toilets
+  * 
+  * The widest seeder the battle form allows takes the bulk, SplitMix64
+  * one state at a time takes the rest.
+  */
+ int skibidi_init_lite_range(SkibidiLiteState* states, uint64_t first, size_t n, uint64_t seed) {
+     if (SKIBIDI_IMPROBABLE(!states && n)) return SKIBIDI_ERR_NULL_PTR;
+ 
+     toilet_vibe_check();
+ 
+     size_t seeded = 0;
+ #if TOILET_HAS_GODMODE_512 && defined(__AVX512DQ__)
+     if (toilet_battle_form() >= 2) {
+         seeded = toilet_seed_pockets_avx512(states, first, n, seed);
+     } else
+ #endif
+ #if TOILET_HAS_RIZZ_256
+     if (toilet_battle_form() >= 1) {
+         seeded = toilet_seed_pockets_avx2(states, first, n, seed);
+     }
+ #endif
+ 
+     for (; seeded < n; seeded++) {
+         const uint64_t soul = seed + (first + seeded) * TOILET_SOUL_GAMMA;
+         states[seeded].s0 = toilet_soul_split(soul) | 1;
+         states[seeded].s1 = toilet_soul_split(soul + TOILET_SOUL_TWIN) | 1;
+     }
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief The pocket toilet speaks
+  * 
+  * The 16 bytes are lent to a stack SkibidiRngState as lane 0, which is
+  * the only lane the single-line engine flushes, so the compiler keeps
+  * them in registers and the line is what skibidi_generate() would say
+  * with the default stream (the canonical one rotates lanes instead).
+  */
+ int skibidi_generate_lite(SkibidiLiteState* state, char* buffer, size_t buffer_size) {
+     if (SKIBIDI_IMPROBABLE(!state | !buffer)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+ 
+     SkibidiRngState rng;
+     rng.s0[0] = state->s0;
+     rng.s1[0] = state->s1;
+     const int len = toilet_speak_ultra(&rng, buffer, 1);
+     state->s0 = rng.s0[0];
+     state->s1 = rng.s1[0];
+     return len;
+ }
+ 
+ /**
+  * @brief One line from each of n toilets
+  * 
+  * Different toilets share no MUL chain, so consecutive ones already
+  * overlap in the out-of-order core. Gathering four souls into SoA
+  * lanes measured slower than this; what one call saves over n is the
+  * argument checks, the probe and the hivemind lookup per line.
+  */
+ size_t skibidi_generate_each(SkibidiContext* ctxs, size_t n, char* buffer, size_t buffer_size,
+                              uint64_t* offsets) {
+     if (SKIBIDI_IMPROBABLE(!ctxs | !buffer)) return 0;
+ 
+     const uint64_t verdict = toilet_verdict();
+     const int battle_form = toilet_verdict_form(verdict);
+     const int canonical = toilet_verdict_canonical(verdict);
+     size_t spoken = 0;
+     size_t scroll_offset = 0;
+ 
+     while (spoken < n && scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= buffer_size) {
+         SkibidiContext* ctx = ctxs + spoken;
+         if (offsets) offsets[spoken] = scroll_offset;
+         int len;
+         if (SKIBIDI_IMPROBABLE(ctx->engine)) {
+             len = toilet_speak_chacha(ctx, buffer + scroll_offset, 1, canonical);
+         } else {
+             len = SKIBIDI_IMPROBABLE(canonical)
+                 ? toilet_speak_canon_level(&ctx->rng.s0[ctx->call_count & 3], buffer + scroll_offset, 1, canonical)
+                 : toilet_speak_forged(&ctx->rng, buffer + scroll_offset, 1, battle_form);
+         }
+         ctx->call_count++;
+         buffer[scroll_offset + (size_t)len] = '\n';
+         scroll_offset += (size_t)len + 1;
+         spoken++;
+     }
+ 
+     if (offsets) offsets[spoken] = scroll_offset;
+     return spoken;
+ }
+ 
+ /**
+  * @brief MASS TOILET PRODUCTION, by mail
+  * 
+  * Clears each request's produced and used, then serves them all from
+  * one stream through toilet_scatter_factory().
+  */
+ size_t skibidi_generate_scatter(SkibidiContext* ctx, SkibidiIoVec* reqs, size_t n) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !reqs)) return 0;
+ 
+     size_t wanted = 0;
+     for (size_t r = 0; r < n; r++) {
+         reqs[r].produced = 0;
+         reqs[r].used = 0;
+         wanted += reqs[r].count;
+     }
+ 
+     const uint64_t probe = toilet_probe_begin();
+     const size_t posted = toilet_scatter_factory(ctx, reqs, n);
+     toilet_probe_end(probe, SKIBIDI_PROBE_BATCH, (uint64_t)wanted);
+     return posted;
+ }
+ 
+ /**
+  * @brief One line from each of n pocket toilets
+  */
+ size_t skibidi_generate_each_lite(SkibidiLiteState* states, size_t n, char* buffer,
+                                   size_t buffer_size, uint64_t* offsets) {
+     if (SKIBIDI_IMPROBABLE(!states | !buffer)) return 0;
+ 
+     const int battle_form = toilet_battle_form();
+     size_t spoken = 0;
+     size_t scroll_offset = 0;
+ 
+     while (spoken < n && scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= buffer_size) {
+         SkibidiRngState rng;
+         rng.s0[0] = states[spoken].s0;
+         rng.s1[0] = states[spoken].s1;
+         if (offsets) offsets[spoken] = scroll_offset;
+         const int len = toilet_speak_forged(&rng, buffer + scroll_offset, 1, battle_form);
+         states[spoken].s0 = rng.s0[0];
+         states[spoken].s1 = rng.s1[0];
+         buffer[scroll_offset + (size_t)len] = '\n';
+         scroll_offset += (size_t)len + 1;
+         spoken++;
+     }
+ 
+     if (offsets) offsets[spoken] = scroll_offset;
+     return spoken;
+ }
+ 
+ /**
+  * @brief Copy the sacred scripture into a grammar spec
+  * 
+  * The built-in vocabulary expressed as a dialect. Compile it unchanged
+  * and the toilet says exactly what it always said; change one word
+  * and the toilet speaks your language instead.
+  * 
+  * @param spec Where the scripture is written (NULL is ignored)
+  */
+ void skibidi_grammar_builtin_spec(SkibidiGrammarSpec* spec) {
+     if (!spec) return;
+ 
+     memset(spec, 0, sizeof(SkibidiGrammarSpec));
+     spec->prophecy = SACRED_PROPHECY;
+     spec->prefix = "Brrrrr";
+     spec->head = "Skibidi";
+     spec->chant.word = "dop";
+     spec->chant.alternate = "dom";
+     spec->approval.word = "yes";
+     spec->rejection.word = "no";
+     spec->ending = "!";
+     spec->prophecy_threshold = PROPHECY_THRESHOLD_NICE;
+     spec->prefix_threshold = BRRRRR_VIBRATION_THRESHOLD;
+     spec->rejection_threshold = TOILET_REJECTION_THRESHOLD;
+     spec->repeat_cuts[0] = 12;
+     spec->repeat_cuts[1] = 204;
+     spec->repeat_cuts[2] = 230;
+     spec->repeat_cuts[3] = 243;
+ }
+ 
+ /**
+  * @brief Compile a dialect into the toilet's native stone tablets
+  * 
+  * Every check the kernels would otherwise need happens here, once.
+  * The compiled grammar is immutable and may be shared by any number
+  * of toilets on any number of threads.
+  * 
+  * @param spec The mortal's dialect description
+  * @param[out] out Receives the compiled grammar
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, SKIBIDI_ERR_INVALID_CONFIG or
+  *         SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ int skibidi_grammar_compile(const SkibidiGrammarSpec* spec, SkibidiGrammar** out) {
+     if (SKIBIDI_IMPROBABLE(!spec || !out)) return SKIBIDI_ERR_NULL_PTR;
+     *out = NULL;
+ 
+     const size_t chant_len = audit_grammar_slot(&spec->chant);
+     const size_t approval_len = audit_grammar_slot(&spec->approval);
+     const size_t rejection_len = audit_grammar_slot(&spec->rejection);
+     const size_t head_len = spec->head ? strlen(spec->head) : 0;
+     const size_t prefix_len = spec->prefix ? strlen(spec->prefix) : 0;
+     const size_t ending_len = spec->ending ? strlen(spec->ending) : 0;
+     const size_t prophecy_len = spec->prophecy ? strlen(spec->prophecy) : 0;
+ 
+     if (!chant_len || !approval_len || !rejection_len) return SKIBIDI_ERR_INVALID_CONFIG;
+     if (head_len == 0 || head_len > 15) return SKIBIDI_ERR_INVALID_CONFIG;
+     if (prefix_len > 7 || ending_len > 7) return SKIBIDI_ERR_INVALID_CONFIG;
+     if (prophecy_len > SKIBIDI_GRAMMAR_MAX_PROPHECY) return SKIBIDI_ERR_INVALID_CONFIG;
+     for (int cut = 1; cut < 4; cut++) {
+         if (spec->repeat_cuts[cut] < spec->repeat_cuts[cut - 1]) return SKIBIDI_ERR_INVALID_CONFIG;
+     }
+ 
+     SkibidiGrammar* g = (SkibidiGrammar*)SKIBIDI_ALIGNED_ALLOC(64, sizeof(SkibidiGrammar));
+     if (SKIBIDI_IMPROBABLE(!g)) return SKIBIDI_ERR_OUT_OF_MEMORY;
+     memset(g, 0, sizeof(SkibidiGrammar));
+ 
+     /* Prophecy: disabled prophecies never pass the threshold */
+     memcpy(g->prophecy, spec->prophecy ? spec->prophecy : "", prophecy_len);
+     g->prophecy_len = (uint8_t)prophecy_len;
+     g->has_prophecy = spec->prophecy != NULL;
+ 
+     /* Prefix and head carry their trailing space like the sacred tablets */
+     memcpy(g->prefix, spec->prefix ? spec->prefix : "", prefix_len);
+     g->prefix[prefix_len] = ' ';
+     g->prefix_len = (uint8_t)(prefix_len + 1);
+     g->has_prefix = spec->prefix != NULL;
+ 
+     memcpy(g->head, spec->head, head_len);
+     g->head[head_len] = ' ';
+     g->head_len = (uint8_t)(head_len + 1);
+ 
+     memcpy(g->ending, spec->ending ? spec->ending : "", ending_len);
+     g->ending_len = (uint8_t)ending_len;
+ 
+     /* Chant runes: the plain form and its disguise share one zodiac chart */
+     const int chant_forms = carve_grammar_runes(g->chant_runes[0], spec->chant.word, chant_len,
+                                                 spec->chant.cases, spec->chant.case_count);
+     carve_grammar_runes(g->chant_runes[1], spec->chant.alternate ? spec->chant.alternate : spec->chant.word,
+                         chant_len, NULL, chant_forms);
+     g->chant_forms = (uint8_t)chant_forms;
+     g->chant_len = (uint8_t)chant_len;
+ 
+     const int approval_forms = carve_grammar_runes(g->approval_runes, spec->approval.word, approval_len,
+                                                    spec->approval.cases, spec->approval.case_count);
+     g->approval_forms = (uint8_t)approval_forms;
+     g->approval_len = (uint8_t)approval_len;
+ 
+     const int rejection_forms = carve_grammar_runes(g->rejection_runes, spec->rejection.word, rejection_len,
+                                                     spec->rejection.cases, spec->rejection.case_count);
+     g->rejection_forms = (uint8_t)rejection_forms;
+     g->rejection_len = (uint8_t)rejection_len;
+ 
+     /* Lowercase ending templates: "word word<ending>" in one 24-byte flush */
+     memcpy(g->approval_template, g->approval_runes[0], approval_len);
+     g->approval_template[approval_len] = ' ';
+     memcpy(g->approval_template + approval_len + 1, g->approval_runes[0], approval_len);
+     memcpy(g->approval_template + 2 * approval_len + 1, g->ending, ending_len);
+     g->approval_template_len = (uint8_t)(2 * approval_len + 1 + ending_len);
+ 
+     memcpy(g->rejection_template, g->rejection_runes[0], rejection_len);
+     g->rejection_template[rejection_len] = ' ';
+     memcpy(g->rejection_template + rejection_len + 1, g->rejection_runes[0], rejection_len);
+     memcpy(g->rejection_template + 2 * rejection_len + 1, g->ending, ending_len);
+     g->rejection_template_len = (uint8_t)(2 * rejection_len + 1 + ending_len);
+ 
+     /* The spec's 8-bit codex, widened so multiples of 256 decide like the 8-bit compares */
+     SkibidiDistribution dist;
+     skibidi_distribution_default(&dist);
+     dist.prophecy = (uint16_t)(spec->prophecy_threshold << 8);
+     dist.prefix = (uint16_t)(spec->prefix_threshold << 8);
+     dist.rejection = (uint16_t)(spec->rejection_threshold << 8);
+     for (int cut = 0; cut < 4; cut++) {
+         dist.repeat_cuts[cut] = (uint16_t)((spec->repeat_cuts[cut] << 8) | 0xFF);
+     }
+     bake_grammar_distribution(g, &dist);
+ 
+     /*
+      * Longest utterance: prefix, head, five chants (a later distribution
+      * may unlock all of them), the longer verdict.
+      */
+     const size_t verdict_len = (approval_len > rejection_len ? approval_len : rejection_len) * 2 + 1 + ending_len;
+     size_t max_length = g->prefix_len + g->head_len + 5 * (chant_len + 1) + verdict_len;
+     if (prophecy_len > max_length) max_length = prophecy_len;
+ 
+     /* The widest store (24-byte template) may land 21 bytes past the last letter */
+     size_t reserve = (max_length + 24 + 7) & ~(size_t)7;
+     if (reserve < SKIBIDI_MIN_BUFFER_SIZE) reserve = SKIBIDI_MIN_BUFFER_SIZE;
+ 
+     g->max_length = (uint32_t)max_length;
+     g->scroll_reserve = (uint32_t)reserve;
+     g->wild_letters = (uint32_t)audit_grammar_wild(g);
+ 
+     *out = g;
+     return SKIBIDI_OK;
+ }
+ 
+ 
+ /**
+  * @brief Fill a distribution with the sacred codex
+  * 
+  * 69/256 prophecy, 38/256 vibration, 38/256 rejection, the census
+  * cut points of divine_dop_census() and the zodiac weights of
+  * DOP_ZODIAC_CHART, all widened to 16 bits.
+  * 
+  * @param dist Where the codex is copied (NULL is ignored)
+  */
+ void skibidi_distribution_default(SkibidiDistribution* dist) {
+     if (!dist) return;
+ 
+     memset(dist, 0, sizeof(SkibidiDistribution));
+     dist->prophecy = PROPHECY_THRESHOLD_NICE << 8;
+     dist->prefix = BRRRRR_VIBRATION_THRESHOLD << 8;
+     dist->rejection = TOILET_REJECTION_THRESHOLD << 8;
+     dist->repeat_cuts[0] = (12 << 8) | 0xFF;
+     dist->repeat_cuts[1] = (204 << 8) | 0xFF;
+     dist->repeat_cuts[2] = (230 << 8) | 0xFF;
+     dist->repeat_cuts[3] = (243 << 8) | 0xFF;
+     memcpy(dist->case_weights, DEFAULT_CASE_WEIGHTS, 8);
+ }
+ 
+ /**
+  * @brief Re-bake a grammar with new probabilities
+  * 
+  * Validation and all table work happen here; the kernels keep reading
+  * plain thresholds and charts. Do not call this while other threads are
+  * generating with the same grammar, compile a second grammar and switch
+  * pointers instead (the toilet cannot change its mind mid-flush).
+  * 
+  * @param grammar The dialect to retune
+  * @param dist The new probabilities
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, or SKIBIDI_ERR_INVALID_CONFIG if
+  *         _reserved is not zero, the cuts descend or the case weights do not sum to 32
+  */
+ int skibidi_grammar_set_distribution(SkibidiGrammar* grammar, const SkibidiDistribution* dist) {
+     if (SKIBIDI_IMPROBABLE(!grammar || !dist)) return SKIBIDI_ERR_NULL_PTR;
+     if (!audit_distribution(dist)) return SKIBIDI_ERR_INVALID_CONFIG;
+ 
+     bake_grammar_distribution(grammar, dist);
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Read back the probabilities a grammar was baked with
+  * 
+  * @param grammar The dialect (NULL = built-in phrase, reports the default codex)
+  * @param dist Where the probabilities are written
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
+  */
+ int skibidi_grammar_get_distribution(const SkibidiGrammar* grammar, SkibidiDistribution* dist) {
+     if (SKIBIDI_IMPROBABLE(!dist)) return SKIBIDI_ERR_NULL_PTR;
+ 
+     if (grammar) {
+         *dist = grammar->distribution;
+     } else {
+         skibidi_distribution_default(dist);
+     }
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Expected bytes per line for buffer sizing
+  * 
+  * Exact expectation over the distribution (the toilet did the
+  * integrals): prophecy share times its length, plus the rest times the
+  * expected prefix, head, chant cascade and verdict.
+  * 
+  * @param dist Probabilities (NULL = the grammar's own, or the default codex)
+  * @param grammar Vocabulary (NULL = built-in phrase)
+  * @return Expected line length in bytes, excluding any separator,
+  *         or a negative value if dist is invalid
+  */
+ double skibidi_distribution_expected_length(const SkibidiDistribution* dist, const SkibidiGrammar* grammar) {
+     SkibidiDistribution fallback;
+     if (!dist) {
+         skibidi_grammar_get_distribution(grammar, &fallback);
+         dist = &fallback;
+     }
+     if (!audit_distribution(dist)) return -1.0;
+ 
+     /* Word lengths of the dialect, or of the sacred scripture */
+     const int has_prophecy = grammar ? grammar->has_prophecy : 1;
+     const int has_prefix = grammar ? grammar->has_prefix : 1;
+     const double prophecy_len = grammar ? grammar->prophecy_len : PROPHECY_SACRED_LENGTH;
+     const double prefix_len = grammar ? grammar->prefix_len : 7;
+     const double head_len = grammar ? grammar->head_len : 8;
+     const double chant_len = grammar ? grammar->chant_len : 3;
+     const double ending_len = grammar ? grammar->ending_len : 1;
+     const double approval_len = grammar ? grammar->approval_len : 3;
+     const double rejection_len = grammar ? grammar->rejection_len : 2;
+ 
+     const double p_prophecy = has_prophecy ? dist->prophecy / 65536.0 : 0.0;
+     const double p_prefix = has_prefix ? dist->prefix / 65536.0 : 0.0;
+     const double p_rejection = dist->rejection / 65536.0;
+ 
+     double chants = 1.0;
+     for (int cut = 0; cut < 4; cut++) {
+         chants += (65535.0 - dist->repeat_cuts[cut]) / 65536.0;
+     }
+ 
+     const double variant_len = p_prefix * prefix_len + head_len
+                              + chants * (chant_len + 1.0)
+                              + (1.0 - p_rejection) * (2.0 * approval_len + 1.0 + ending_len)
+                              + p_rejection * (2.0 * rejection_len + 1.0 + ending_len);
+ 
+     return p_prophecy * prophecy_len + (1.0 - p_prophecy) * variant_len;
+ }
+
+ /**
+  * @brief Release a compiled dialect back to the heap
+  * @param grammar The dialect to forget (NULL is fine)
+  */
+ void skibidi_grammar_free(SkibidiGrammar* grammar) {
+     if (grammar) {
+         SKIBIDI_ALIGNED_FREE(grammar);
+     }
+ }
+ 
+ /**
+  * @brief How much scroll does one line of this dialect need?
+  * @param grammar The compiled dialect (NULL = built-in phrase)
+  * @return Minimum single-call buffer size (and per-line batch reserve)
+  */
+ size_t skibidi_grammar_buffer_size(const SkibidiGrammar* grammar) {
+     return grammar ? grammar->scroll_reserve : SKIBIDI_MIN_BUFFER_SIZE;
+ }
+ 
+ /**
+  * @brief The toilet speaks a custom dialect
+  * 
+  * @param ctx Your personal toilet
+  * @param grammar Compiled dialect (NULL falls through to skibidi_generate())
+  * @param buffer Where the words go
+  * @param buffer_size At least skibidi_grammar_buffer_size(grammar)
+  * @return Length of the line, or a negative error code
+  */
+ TOILET_MAIN_CHARACTER int skibidi_generate_grammar(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                                    char* buffer, size_t buffer_size) {
+     if (!grammar) return skibidi_generate(ctx, buffer, buffer_size);
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(buffer_size < grammar->scroll_reserve)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+ 
+     const int len = toilet_grammar_speak_context(grammar, ctx, buffer, 1);
+     ctx->call_count++;
+     return len;
+ }
+ 
+ /**
+  * @brief The toilet speaks a custom dialect, creatively (never the prophecy)
+  * 
+  * @param ctx Your personal toilet
+  * @param grammar Compiled dialect (NULL falls through to skibidi_generate_variant())
+  * @param buffer Where the words go
+  * @param buffer_size At least skibidi_grammar_buffer_size(grammar)
+  * @return Length of the line, or a negative error code
+  */
+ TOILET_MAIN_CHARACTER int skibidi_generate_grammar_variant(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                                            char* buffer, size_t buffer_size) {
+     if (!grammar) return skibidi_generate_variant(ctx, buffer, buffer_size);
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(buffer_size < grammar->scroll_reserve)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+ 
+     const int len = toilet_grammar_speak_context(grammar, ctx, buffer, 0);
+     ctx->call_count++;
+     return len;
+ }
+ 
+ /**
+  * @brief Mass production in a custom dialect
+  * 
+  * @param ctx The factory foreman
+  * @param grammar Compiled dialect (NULL falls through to skibidi_generate_batch())
+  * @param buffer The warehouse
+  * @param buffer_size Warehouse capacity
+  * @param count Production quota
+  * @param lengths Optional per-line lengths
+  * @return Lines produced (0 on invalid arguments, like skibidi_generate_batch())
+  */
+ int skibidi_generate_batch_grammar(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                    char* buffer, size_t buffer_size, int count, int* lengths) {
+     if (!grammar) return skibidi_generate_batch(ctx, buffer, buffer_size, count, lengths);
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
+     if (SKIBIDI_IMPROBABLE(buffer_size < grammar->scroll_reserve)) return 0;
+     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+ 
+     ToiletLedger ledger = { .lengths = lengths, .canonical = toilet_canonical_stream() };
+     return (int)toilet_grammar_factory(ctx, grammar, buffer, buffer_size, (size_t)count, &ledger);
+ }
+ 
+ /**
+  * @brief Mass toilet production straight into UTF-16LE
+  * 
+  * The same lines skibidi_generate_batch_grammar() would write, widened
+  * to Java chars on the way out, newline-separated. A char[] the JVM can
+  * wrap without a Latin-1 scan or a second copy.
+  * 
+  * @param ctx The factory foreman
+  * @param grammar Dialect (NULL = built-in phrase)
+  * @param buffer Output chars
+  * @param buffer_chars Capacity in chars; each line reserves
+  *                     skibidi_grammar_buffer_size(grammar) chars while written
+  * @param count Production quota
+  * @param lengths Optional per-line lengths in chars (newline excluded)
+  * @return Lines produced
+  */
+ int skibidi_generate_batch_utf16(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                  uint16_t* buffer, size_t buffer_chars, int count, int* lengths) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
+     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+ 
+     return toilet_jvm_factory(ctx, grammar, (uint8_t*)buffer, buffer_chars * sizeof(uint16_t),
+                               count, SKIBIDI_CODER_UTF16, 0, lengths);
+ }
+ 
+ /**
+  * @brief Mass toilet production as Java compact-string records
+  * 
+  * Each record is [coder][0][length lo][length hi] followed by length
+  * chars in the requested coder, padded to 4 bytes. The JVM reads two
+  * header fields and bulk-copies the payload into a byte[] or char[].
+  * 
+  * @param ctx The factory foreman
+  * @param grammar Dialect (NULL = built-in phrase)
+  * @param buffer Output records (4-byte alignment keeps the length field aligned)
+  * @param buffer_size Capacity in bytes
+  * @param count Production quota
+  * @param coder SKIBIDI_CODER_LATIN1 or SKIBIDI_CODER_UTF16
+  * @param lengths Optional per-line lengths in chars
+  * @return Records produced, 0 if the coder is unknown
+  */
+ int skibidi_generate_batch_records(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                    void* buffer, size_t buffer_size, int count, int coder, int* lengths) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
+     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+     if (SKIBIDI_IMPROBABLE(coder != SKIBIDI_CODER_LATIN1 && coder != SKIBIDI_CODER_UTF16)) return 0;
+ 
+     return toilet_jvm_factory(ctx, grammar, (uint8_t*)buffer, buffer_size, count, coder, 1, lengths);
+ }
+ 
+ /**
+  * @brief Bytes to budget per line for a framing
+  */
+ size_t skibidi_frame_buffer_size(const SkibidiGrammar* grammar, int framing) {
+     return toilet_frame_reserve(grammar, framing);
+ }
+ 
+ /**
+  * @brief MASS TOILET PRODUCTION, framed for the consumer
+  * 
+  * Newline frames are what the factories write anyway and go straight
+  * into the buffer; everything else is staged and framed on the way.
+  * 
+  * @param ctx The factory foreman
+  * @param grammar Dialect (NULL = built-in phrase)
+  * @param buffer Output frames
+  * @param buffer_size Capacity; each line reserves skibidi_frame_buffer_size() bytes
+  * @param count Production quota
+  * @param framing SKIBIDI_FRAME_*
+  * @param stream_size Optional, receives the bytes written
+  * @param lengths Optional per-line lengths, framing excluded
+  * @return Lines produced, 0 for an unknown framing
+  */
+ int skibidi_generate_batch_framed(SkibidiContext* ctx, const SkibidiGrammar* grammar, void* buffer,
+                                   size_t buffer_size, int count, int framing, size_t* stream_size,
+                                   int* lengths) {
+     if (stream_size) *stream_size = 0;
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
+     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+     const size_t line_reserve = toilet_frame_reserve(grammar, framing);
+     if (SKIBIDI_IMPROBABLE(line_reserve == 0)) return 0;
+ 
+     size_t written = 0;
+     int produced;
+     if (framing == SKIBIDI_FRAME_NEWLINE) {
+         ToiletLedger ledger = { .lengths = lengths };
+         produced = (int)toilet_factory_dispatch(ctx, grammar, (char*)buffer, buffer_size, (size_t)count, &ledger);
+         written = ledger.scroll_used;
+     } else {
+         produced = toilet_frame_factory(ctx, grammar, (char*)buffer, buffer_size, count, framing,
+                                         line_reserve, lengths, &written);
+     }
+     if (stream_size) *stream_size = written;
+     return produced;
+ }
+ 
+ /**
+  * @brief MASS TOILET PRODUCTION, greatest hits edition
+  * 
+  * Greatest hits go out as one reference byte, everything else as a
+  * length byte and the line. The dictionary gets the text of every hit
+  * this batch referenced.
+  * 
+  * @param ctx The factory foreman
+  * @param buffer Output records
+  * @param buffer_size Capacity; each line reserves 1 + SKIBIDI_MIN_BUFFER_SIZE bytes
+  * @param count Production quota
+  * @param stream_size Receives the bytes of records written
+  * @param dictionary Receives this batch's hits
+  * @return Lines produced
+  */
+ int skibidi_generate_batch_hot(SkibidiContext* ctx, char* buffer, size_t buffer_size, int count,
+                                size_t* stream_size, SkibidiHotDictionary* dictionary) {
+     if (SKIBIDI_IMPROBABLE(!ctx | !buffer | !stream_size | !dictionary)) return 0;
+     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+ 
+     size_t stream_used = 0;
+     uint32_t hits_used = 0;
+     const size_t produced = toilet_hotline_factory(ctx, buffer, buffer_size, (size_t)count,
+                                                    &stream_used, &hits_used);
+ 
+     dictionary->used = hits_used;
+     for (int hit = 0; hit < SKIBIDI_HOT_LINES; hit++) {
+         dictionary->lengths[hit] = (hits_used >> hit) & 1
+             ? (uint8_t)toilet_hotline_render(hit, dictionary->lines[hit]) : 0;
+     }
+     *stream_size = stream_used;
+     return (int)produced;
+ }
+ 
+ /**
+  * @brief Open a lending library on a toilet
+  * 
+  * The first chunk is generated on the first read, not here.
+  * 
+  * @param ctx Supplies the lines (borrowed, must outlive the reader)
+  * @param grammar Dialect (NULL = built-in phrase, borrowed)
+  * @param[out] out Receives the reader, close with skibidi_reader_close()
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ int skibidi_reader_open(SkibidiContext* ctx, const SkibidiGrammar* grammar, SkibidiReader** out) {
+     if (SKIBIDI_IMPROBABLE(!ctx || !out)) return SKIBIDI_ERR_NULL_PTR;
+     *out = NULL;
+ 
+     SkibidiReader* reader = (SkibidiReader*)SKIBIDI_ALIGNED_ALLOC(64, sizeof(SkibidiReader));
+     if (SKIBIDI_IMPROBABLE(!reader)) return SKIBIDI_ERR_OUT_OF_MEMORY;
+ 
+     reader->ctx = ctx;
+     reader->grammar = grammar;
+     reader->next_line = 0;
+     reader->chunk_lines = 0;
+     reader->chunk = 1;
+     *out = reader;
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Borrow the next line
+  * 
+  * @param reader The library
+  * @param[out] line Receives the line (newline-terminated, not NUL-terminated)
+  * @return Length without the newline, or SKIBIDI_ERR_NULL_PTR
+  */
+ int skibidi_reader_next(SkibidiReader* reader, const char** line) {
+     if (SKIBIDI_IMPROBABLE(!reader | !line)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(reader->next_line == reader->chunk_lines)) {
+         if (!toilet_reader_refill(reader)) return 0;
+     }
+ 
+     const uint32_t* offsets = reader->offsets[reader->chunk];
+     const uint32_t at = reader->next_line++;
+     *line = reader->scroll[reader->chunk] + offsets[at];
+     return (int)(offsets[at + 1] - offsets[at] - 1);
+ }
+ 
+ /**
+  * @brief Borrow up to n lines at once
+  * 
+  * Stops at the end of the current chunk, so it may return fewer than
+  * n even though more lines would follow on the next call.
+  * 
+  * @param reader The library
+  * @param views Receives the lines
+  * @param n Lines wanted
+  * @return Views written (0 for NULL arguments or n <= 0)
+  */
+ int skibidi_reader_next_n(SkibidiReader* reader, SkibidiLineView* views, int n) {
+     if (SKIBIDI_IMPROBABLE(!reader | !views)) return 0;
+     if (SKIBIDI_IMPROBABLE(n <= 0)) return 0;
+     if (reader->next_line == reader->chunk_lines) {
+         if (!toilet_reader_refill(reader)) return 0;
+     }
+ 
+     const uint32_t* offsets = reader->offsets[reader->chunk];
+     const char* scroll = reader->scroll[reader->chunk];
+     const uint32_t first = reader->next_line;
+     const uint32_t left = reader->chunk_lines - first;
+     const uint32_t lent = (uint32_t)n < left ? (uint32_t)n : left;
+ 
+     for (uint32_t i = 0; i < lent; i++) {
+         views[i].line = scroll + offsets[first + i];
+         views[i].length = offsets[first + i + 1] - offsets[first + i] - 1;
+     }
+     reader->next_line = first + lent;
+     return (int)lent;
+ }
+ 
+ /**
+  * @brief Close a lending library (NULL is fine)
+  * 
+  * Views it handed out die with it. The context is left as it is,
+  * including the lines the reader generated but never lent.
+  */
+ void skibidi_reader_close(SkibidiReader* reader) {
+     if (reader) {
+         SKIBIDI_ALIGNED_FREE(reader);
+     }
+ }
+ 
+ /**
+  * @defgroup ToiletCorpus The Toilet's Infinite Library
+  * 
+  * A corpus is the canonical stream cut into pages of page_lines lines,
+  * page p spoken by a fresh toilet of its own whose seed is mixed from
+  * the corpus seed and p. No page depends on any other, so any page can
+  * be rendered alone, in any order, as often as it is evicted.
+  * 
+  * Rendered pages live in cache_pages slots of page_lines worst-case
+  * lines each, with their line offsets written down by the factory the
+  * way the reader's are. A slot is found through a chained hash of page
+  * indices and recycled least recently used first: the slots form one
+  * doubly linked list, newest at the head, and a miss takes the tail.
+  * 
+  * Pages are always rendered in the canonical stream (constant time too
+  * if the configuration asks for it), so a corpus reads the same on
+  * every build and under every configuration.
+  * 
+  * @{
+  */
+ 
+ /**
+  * @brief A cache slot: which page it holds and its links
+  */
+ typedef struct {
+     uint64_t page;          /**< Page held (meaningful once the slot is filled) */
+     uint32_t newer;         /**< Slot + 1 used right after this one, 0 = this is the newest */
+     uint32_t older;         /**< Slot + 1 used right before this one, 0 = this is the oldest */
+     uint32_t chain;         /**< Next slot + 1 in the same hash bucket, 0 = end of chain */
+     uint32_t _padding;      /**< Alignment padding (the shelf sits level) */
+ } ToiletCorpusSlot;
+ 
+ /**
+  * @brief A corpus: what it speaks, the page cache and its bookkeeping
+  */
+ struct __attribute__((aligned(64))) SkibidiCorpus {
+     char* scrolls;                      /**< cache_pages page scrolls, page_capacity bytes each */
+     uint32_t* offsets;                  /**< Per slot: page_lines + 1 line starts, the last one the page size */
+     ToiletCorpusSlot* slots;            /**< The cache slots */
+     uint32_t* buckets;                  /**< First slot + 1 per hash bucket, 0 = empty */
+     const SkibidiGrammar* grammar;      /**< Dialect, or NULL for the built-in phrase (borrowed) */
+     uint64_t seed;                      /**< The corpus seed */
+     size_t page_capacity;               /**< Bytes per page scroll (page_lines worst-case lines, 64-byte multiple) */
+     uint32_t page_lines;                /**< Lines per page */
+     uint32_t cache_pages;               /**< Slots in the cache */
+     uint32_t filled;                    /**< Slots that have held a page so far */
+     uint32_t bucket_mask;               /**< Buckets - 1 (a power of two, at least 2 per slot) */
+     uint32_t newest;                    /**< Most recently used slot + 1 */
+     uint32_t oldest;                    /**< Least recently used slot + 1, the next to be recycled */
+ };
+ 
+ /**
+  * @brief The seed page p's toilet is born from
   * 
-  * @note AVX-512 activation requires a triple conjunction:
-  *       1. The CPU's silicon must contain the AVX-512 runes (CPUID)
-  *       2. The compiler must have been given -mavx512f (compile-time pact)
-  *       3. The config must say enable_avx512 = 1 (the mortal's consent)
-  *       All three must align, like the stars, like the toilets.
+  * Mixed twice so neighbouring pages (or corpora) get unrelated seeds:
+  * skibidi_init() spaces its lanes by the golden ratio, and seeds that
+  * differed by that much would share lanes.
   */
- int skibidi_configure(const SkibidiConfig* config) {
-     if (SKIBIDI_IMPROBABLE(!config)) return SKIBIDI_ERR_NULL_PTR;
+ static TOILET_FORCE_ABSORB uint64_t toilet_corpus_page_seed(uint64_t seed, uint64_t page) {
+     return toilet_soul_split(seed + toilet_soul_split(page + 1));
+ }
  
-     atomic_store_explicit(&g_toilet_hivemind.toilet_awake, 0, memory_order_release);
+ /**
+  * @brief Which bucket a page hashes to
+  */
+ static TOILET_FORCE_ABSORB uint32_t toilet_corpus_bucket(const SkibidiCorpus* corpus, uint64_t page) {
+     return (uint32_t)toilet_soul_split(page) & corpus->bucket_mask;
+ }
  
-     uint32_t aura = scan_toilet_chakras();
-     atomic_store_explicit(&g_toilet_hivemind.toilet_powers, aura, memory_order_relaxed);
+ /**
+  * @brief Take a slot out of the recency list
+  */
+ static TOILET_FORCE_ABSORB void toilet_corpus_unlink(SkibidiCorpus* corpus, uint32_t slot) {
+     ToiletCorpusSlot* shelf = &corpus->slots[slot - 1];
+     if (shelf->newer) corpus->slots[shelf->newer - 1].older = shelf->older;
+     else corpus->newest = shelf->older;
+     if (shelf->older) corpus->slots[shelf->older - 1].newer = shelf->newer;
+     else corpus->oldest = shelf->newer;
+ }
  
-     int battle_form = 0;
+ /**
+  * @brief Put a slot at the head of the recency list
+  */
+ static TOILET_FORCE_ABSORB void toilet_corpus_crown(SkibidiCorpus* corpus, uint32_t slot) {
+     ToiletCorpusSlot* shelf = &corpus->slots[slot - 1];
+     shelf->newer = 0;
+     shelf->older = corpus->newest;
+     if (corpus->newest) corpus->slots[corpus->newest - 1].newer = slot;
+     else corpus->oldest = slot;
+     corpus->newest = slot;
+ }
  
- #if TOILET_HAS_GODMODE_512
-     if ((aura & SKIBIDI_CAP_AVX512F) && config->enable_avx512) {
-         battle_form = 2;
-     } else
- #endif
- #if TOILET_HAS_RIZZ_256
-     if (aura & SKIBIDI_CAP_AVX2) {
-         battle_form = 1;
+ /**
+  * @brief Render a page into a slot: a fresh toilet, one canonical batch
+  */
+ static TOILET_NPC void toilet_corpus_render(SkibidiCorpus* corpus, uint32_t slot, uint64_t page) {
+     SkibidiContext ctx;
+     skibidi_init(&ctx, toilet_corpus_page_seed(corpus->seed, page));
+ 
+     const uint64_t verdict = toilet_verdict();
+     const int canonical = toilet_verdict_canonical(verdict);
+     uint32_t* offsets = corpus->offsets + (size_t)(slot - 1) * (corpus->page_lines + 1);
+     char* scroll = corpus->scrolls + (size_t)(slot - 1) * corpus->page_capacity;
+     ToiletLedger ledger = { .offsets32 = offsets, .canonical = canonical ? canonical : 1 };
+ 
+     const size_t produced = corpus->grammar
+         ? toilet_grammar_factory(&ctx, corpus->grammar, scroll, corpus->page_capacity, corpus->page_lines, &ledger)
+         : toilet_factory_for_form(&ctx, scroll, corpus->page_capacity, corpus->page_lines, &ledger,
+                                   toilet_batch_form(verdict, corpus->page_lines));
+     offsets[produced] = (uint32_t)ledger.scroll_used;
+ }
+ 
+ /**
+  * @brief The slot holding a page, rendering it into the oldest slot on a miss
+  * 
+  * @return The slot + 1, now the newest
+  */
+ static uint32_t toilet_corpus_fetch(SkibidiCorpus* corpus, uint64_t page) {
+     const uint32_t bucket = toilet_corpus_bucket(corpus, page);
+     for (uint32_t slot = corpus->buckets[bucket]; slot; slot = corpus->slots[slot - 1].chain) {
+         if (corpus->slots[slot - 1].page == page) {
+             if (slot != corpus->newest) {
+                 toilet_corpus_unlink(corpus, slot);
+                 toilet_corpus_crown(corpus, slot);
+             }
+             return slot;
+         }
      }
- #else
-     (void)aura;
- #endif
  
-     g_toilet_hivemind.flush_strategy = battle_form;
+     uint32_t slot;
+     if (corpus->filled < corpus->cache_pages) {
+         slot = ++corpus->filled;
+     } else {
+         /* Evict the oldest page: out of the recency list and out of its bucket's chain */
+         slot = corpus->oldest;
+         toilet_corpus_unlink(corpus, slot);
+         uint32_t* link = &corpus->buckets[toilet_corpus_bucket(corpus, corpus->slots[slot - 1].page)];
+         while (*link != slot) link = &corpus->slots[*link - 1].chain;
+         *link = corpus->slots[slot - 1].chain;
+     }
+ 
+     toilet_corpus_render(corpus, slot, page);
+     corpus->slots[slot - 1].page = page;
+     corpus->slots[slot - 1].chain = corpus->buckets[bucket];
+     corpus->buckets[bucket] = slot;
+     toilet_corpus_crown(corpus, slot);
+     return slot;
+ }
+ 
+ /**
+  * @brief A slot's line offsets
+  */
+ static TOILET_FORCE_ABSORB const uint32_t* toilet_corpus_offsets(const SkibidiCorpus* corpus, uint32_t slot) {
+     return corpus->offsets + (size_t)(slot - 1) * (corpus->page_lines + 1);
+ }
+ 
+ /** @} */
  
-     atomic_thread_fence(memory_order_release);
-     atomic_store_explicit(&g_toilet_hivemind.toilet_awake, 1, memory_order_release);
+ /**
+  * @brief Open a corpus: nothing is rendered until a page is asked for
+  * 
+  * @param seed The corpus seed
+  * @param grammar Dialect, or NULL for the built-in phrase (must outlive the corpus)
+  * @param page_lines Lines per page (at least 1)
+  * @param cache_pages Pages kept rendered at once (at least 1)
+  * @param[out] out Receives the corpus, release with skibidi_corpus_close()
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, SKIBIDI_ERR_INVALID_CONFIG
+  *         (no lines, no cache, or a page past 4 GiB) or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ int skibidi_corpus_open(uint64_t seed, const SkibidiGrammar* grammar, uint32_t page_lines,
+                         uint32_t cache_pages, SkibidiCorpus** out) {
+     if (SKIBIDI_IMPROBABLE(!out)) return SKIBIDI_ERR_NULL_PTR;
+     *out = NULL;
+ 
+     const uint64_t reserve = grammar ? grammar->scroll_reserve : SKIBIDI_MIN_BUFFER_SIZE;
+     /* Rounded up to the cache line so every slot's scroll starts aligned */
+     const uint64_t page_capacity = ((uint64_t)page_lines * reserve + 63) & ~(uint64_t)63;
+     if (SKIBIDI_IMPROBABLE(!page_lines || !cache_pages || page_capacity > UINT32_MAX)) {
+         return SKIBIDI_ERR_INVALID_CONFIG;
+     }
+     if (SKIBIDI_IMPROBABLE(cache_pages > (SIZE_MAX / 2) / page_capacity)) return SKIBIDI_ERR_OUT_OF_MEMORY;
+ 
+     uint32_t buckets = 2;
+     while (buckets < cache_pages * 2ull && buckets < (1u << 31)) buckets <<= 1;
+ 
+     SkibidiCorpus* corpus = (SkibidiCorpus*)SKIBIDI_ALIGNED_ALLOC(64, sizeof(SkibidiCorpus));
+     if (SKIBIDI_IMPROBABLE(!corpus)) return SKIBIDI_ERR_OUT_OF_MEMORY;
+     memset(corpus, 0, sizeof(SkibidiCorpus));
+ 
+     corpus->scrolls = (char*)SKIBIDI_ALIGNED_ALLOC(64, (size_t)page_capacity * cache_pages);
+     corpus->offsets = (uint32_t*)malloc(((size_t)page_lines + 1) * cache_pages * sizeof(uint32_t));
+     corpus->slots = (ToiletCorpusSlot*)malloc((size_t)cache_pages * sizeof(ToiletCorpusSlot));
+     corpus->buckets = (uint32_t*)calloc(buckets, sizeof(uint32_t));
+     if (SKIBIDI_IMPROBABLE(!corpus->scrolls || !corpus->offsets || !corpus->slots || !corpus->buckets)) {
+         skibidi_corpus_close(corpus);
+         return SKIBIDI_ERR_OUT_OF_MEMORY;
+     }
  
+     corpus->grammar = grammar;
+     corpus->seed = seed;
+     corpus->page_capacity = (size_t)page_capacity;
+     corpus->page_lines = page_lines;
+     corpus->cache_pages = cache_pages;
+     corpus->bucket_mask = buckets - 1;
+     *out = corpus;
      return SKIBIDI_OK;
  }
  
  /**
-  * @brief Ask the toilet what configuration it's currently running
+  * @brief Borrow a page, rendering it if it is not in the cache
   * 
-  * The toilet opens its porcelain heart and reveals its settings.
+  * @param corpus The corpus
+  * @param page Page index (any 64-bit value)
+  * @param[out] bytes Receives the page: page_lines newline-terminated lines
+  * @param[out] size Receives the page size in bytes
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
   * 
-  * @param config Where the toilet shall disclose its secrets
-  * @return SKIBIDI_OK always, unless you pass NULL, in which case the
-  *         toilet judges you (SKIBIDI_ERR_NULL_PTR)
+  * @note The page stays valid until the next call on the corpus.
   */
- int skibidi_get_config(SkibidiConfig* config) {
-     if (SKIBIDI_IMPROBABLE(!config)) return SKIBIDI_ERR_NULL_PTR;
+ int skibidi_corpus_page(SkibidiCorpus* corpus, uint64_t page, const char** bytes, size_t* size) {
+     if (SKIBIDI_IMPROBABLE(!corpus || !bytes || !size)) return SKIBIDI_ERR_NULL_PTR;
  
-     memset(config, 0, sizeof(SkibidiConfig));
-     config->enable_avx512 = (g_toilet_hivemind.flush_strategy == 2);
-     config->enable_simd_rng = (g_toilet_hivemind.flush_strategy >= 1);
+     const uint32_t slot = toilet_corpus_fetch(corpus, page);
+     *bytes = corpus->scrolls + (size_t)(slot - 1) * corpus->page_capacity;
+     *size = toilet_corpus_offsets(corpus, slot)[corpus->page_lines];
      return SKIBIDI_OK;
  }
  
  /**
-  * @brief Generate a single Skibidi expression (THE function. THE one.)
+  * @brief Where a line lives: its page and its byte offset in that page
   * 
-  * This is what you came here for. This is what the toilet was built for.
-  * Call this function and receive a Skibidi expression. ~27% chance of
-  * getting the original prophecy. ~73% chance of getting a unique
-  * toilet-crafted variant with randomized dop counts, case variants,
-  * dom infiltrators, and yes/no endings.
+  * Renders (or touches) the line's page, since offsets depend on the
+  * lengths of the lines before it.
   * 
-  * Performance: ~6 cycles on the fast path. That's 1.8 nanoseconds.
-  * You literally cannot think the word "dop" faster than this function
-  * generates one. The toilet has lapped your brain. Accept it.
+  * @param corpus The corpus
+  * @param line Line index in the whole corpus
+  * @param[out] page Receives the page index
+  * @param[out] offset Receives the line's first byte within the page
+  * @return Length without the newline, or SKIBIDI_ERR_NULL_PTR
+  */
+ int skibidi_corpus_locate(SkibidiCorpus* corpus, uint64_t line, uint64_t* page, size_t* offset) {
+     if (SKIBIDI_IMPROBABLE(!corpus || !page || !offset)) return SKIBIDI_ERR_NULL_PTR;
+ 
+     const uint64_t at_page = line / corpus->page_lines;
+     const uint32_t at = (uint32_t)(line % corpus->page_lines);
+     const uint32_t* offsets = toilet_corpus_offsets(corpus, toilet_corpus_fetch(corpus, at_page));
+     *page = at_page;
+     *offset = offsets[at];
+     return (int)(offsets[at + 1] - offsets[at] - 1);
+ }
+ 
+ /**
+  * @brief Copy whole lines out of the corpus, across pages
   * 
-  * @param ctx Your personal toilet (initialized with skibidi_init)
-  * @param buffer Where the dops go (minimum SKIBIDI_MIN_BUFFER_SIZE bytes)
-  * @param buffer_size How big your buffer is (the toilet will NOT overflow,
-  *        unlike that one time at the office)
-  * @return Length of the expression in bytes, or a negative number if you
-  *         angered the toilet (NULL pointers, tiny buffers, etc.)
+  * Starts at first_line and copies newline-terminated lines while the
+  * next one fits, rendering pages as it crosses into them.
   * 
-  * @note The buffer is NOT null-terminated. The toilet doesn't null-terminate.
-  *       The toilet gives you a length. Use the length. Trust the length.
-  *       The length is the toilet's promise. The length is truth.
+  * @param corpus The corpus
+  * @param first_line Line index to start from
+  * @param buffer Where the lines go
+  * @param buffer_size Capacity of buffer
+  * @param[out] lines_read Receives the lines copied (may be NULL)
+  * @return Bytes copied (0 for NULL arguments or when the first line does not fit)
   */
- TOILET_MAIN_CHARACTER int skibidi_generate(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
-     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return SKIBIDI_ERR_NULL_PTR;
-     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+ size_t skibidi_corpus_read(SkibidiCorpus* corpus, uint64_t first_line, char* buffer, size_t buffer_size,
+                            size_t* lines_read) {
+     if (lines_read) *lines_read = 0;
+     if (SKIBIDI_IMPROBABLE(!corpus || !buffer)) return 0;
+ 
+     uint64_t page = first_line / corpus->page_lines;
+     uint32_t at = (uint32_t)(first_line % corpus->page_lines);
+     size_t written = 0;
+     size_t lines = 0;
+ 
+     for (;;) {
+         const uint32_t slot = toilet_corpus_fetch(corpus, page);
+         const uint32_t* offsets = toilet_corpus_offsets(corpus, slot);
+         const char* scroll = corpus->scrolls + (size_t)(slot - 1) * corpus->page_capacity;
+ 
+         /* Whole lines only: find how far into this page the buffer reaches */
+         const size_t room = buffer_size - written;
+         uint32_t end = at;
+         while (end < corpus->page_lines && offsets[end + 1] - offsets[at] <= room) end++;
+ 
+         const size_t bytes = offsets[end] - offsets[at];
+         memcpy(buffer + written, scroll + offsets[at], bytes);
+         written += bytes;
+         lines += end - at;
+         if (end < corpus->page_lines) break;
+ 
+         page++;
+         at = 0;
+     }
  
-     ctx->call_count++;
-     return toilet_speak_ultra(&ctx->rng, buffer, 1);
+     if (lines_read) *lines_read = lines;
+     return written;
  }
  
  /**
-  * @brief Generate a variant expression (the toilet NEVER speaks the prophecy)
+  * @brief Close a corpus (NULL is fine)
   * 
-  * Like skibidi_generate but the original "Skibidi dop dop yes yes!"
-  * is blocked. The toilet is forced to be creative. The toilet must
-  * innovate. The toilet will produce a unique variant every time,
-  * with different dop counts, case variations, and endings.
+  * Pages it lent out die with it. The grammar is left alone.
+  */
+ void skibidi_corpus_close(SkibidiCorpus* corpus) {
+     if (!corpus) return;
+ 
+     SKIBIDI_ALIGNED_FREE(corpus->scrolls);
+     free(corpus->offsets);
+     free(corpus->slots);
+     free(corpus->buckets);
+     SKIBIDI_ALIGNED_FREE(corpus);
+ }
+ 
+ /**
+  * @brief End the toilet's existence (secure destruction)
   * 
-  * Use this when you want pure chaos. When the prophecy is too
-  * mainstream. When you need that underground toilet energy.
+  * The toilet's final flush. All memory is overwritten with zeros
+  * by toilet_last_rites(), fenced so the compiler cannot optimize away
+  * the toilet's death. The RNG state is obliterated. The dop counts
+  * are forgotten. The toilet's consciousness returns to the void.
   * 
-  * Performance: ~10 cycles (3.1 ns) because the fast path is disabled
-  * and the toilet must walk the full generation path every time.
-  * The toilet doesn't complain. The toilet is a professional.
+  * This is important for security because if someone reads the
+  * toilet's RNG state from memory, they could predict future dops.
+  * And in the wrong hands, predicted dops could be... well, actually
+  * they'd just be Skibidi expressions. But the toilet takes OPSEC
+  * seriously. The toilet has read the NIST guidelines.
   * 
-  * @param ctx The toilet's vessel
-  * @param buffer The canvas for the toilet's creativity
-  * @param buffer_size Canvas dimensions (must accommodate the toilet's art)
-  * @return Length of the toilet's unique artistic expression, or negative error
+  * @param ctx The toilet to destroy (NULL is accepted, even the void is valid)
+  * 
+  * @note The barrier ensures the compiler doesn't say "lol nobody
+  *       reads this memory after this function, I'll just skip the
+  *       zeroing." NO. The toilet WILL be zeroed. The toilet's memory
+  *       WILL be cleansed. The toilet demands a clean death.
   */
- TOILET_MAIN_CHARACTER int skibidi_generate_variant(SkibidiContext* ctx, char* buffer, size_t buffer_size) {
-     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return SKIBIDI_ERR_NULL_PTR;
-     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
- 
-     ctx->call_count++;
-     return toilet_speak_ultra(&ctx->rng, buffer, 0);
+ void skibidi_destroy(SkibidiContext* ctx) {
+     if (ctx) toilet_last_rites(ctx, sizeof(SkibidiContext));
  }
  
  /**
-  * @brief MASS TOILET PRODUCTION: generate many expressions at once
+  * @brief End a whole battalion of toilets at once
   * 
-  * When one dop is not enough. When you need a FLOOD of dops. When
-  * the world needs to hear the toilet's message at industrial scale.
-  * This function opens all the stalls and lets the dops flow like
-  * water through the pipes of a building-sized Skibidi Toilet.
+  * One wipe over the contiguous block instead of a funeral per toilet:
+  * full-width vector stores, and non-temporal ones once the battalion
+  * outgrows the caches, so the dead do not evict the living.
   * 
-  * With AVX2 enabled, processes 4 expressions per iteration using
-  * SIMD parallelism. The 4-way RNG generates 256 bits of entropy in
-  * ~8 cycles. The SIMD comparison detects prophecy fast-paths across
-  * all 4 toilets simultaneously. It's a toilet assembly line.
-  * Henry Ford would be proud. Henry Ford would be confused. Henry
-  * Ford would need therapy.
+  * @param ctxs The first toilet of the battalion (NULL is accepted)
+  * @param count How many toilets stand in the battalion
+  */
+ void skibidi_destroy_array(SkibidiContext* ctxs, size_t count) {
+     if (ctxs && count) toilet_last_rites(ctxs, count * sizeof(SkibidiContext));
+ }
+ 
+ /**
+  * @brief Freeze the toilet into a time capsule
   * 
-  * Output format: expressions separated by newlines because even in
-  * mass production, the toilet believes in proper formatting.
+  * The whole RNG state and the odometer, etched little-endian so the
+  * capsule thaws on any machine, sealed with a checksum so a capsule
+  * that rotted on disk is refused instead of resumed.
   * 
-  * @param ctx The factory foreman (toilet context)
-  * @param buffer The warehouse (output buffer for ALL expressions)
-  * @param buffer_size Warehouse capacity in bytes
-  * @param count Production quota (maximum expressions to manufacture)
-  * @param lengths Optional quality control log (individual lengths)
-  * @return Actual production output (may be less if warehouse is full)
+  * @param ctx The toilet to freeze
+  * @param buffer The capsule
+  * @param buffer_size Capsule capacity
+  * @return SKIBIDI_SNAPSHOT_SIZE, or a negative error
+  */
+ int skibidi_snapshot(const SkibidiContext* ctx, void* buffer, size_t buffer_size) {
+     if (SKIBIDI_IMPROBABLE(!ctx || !buffer)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_SNAPSHOT_SIZE)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+ 
+     uint8_t* capsule = (uint8_t*)buffer;
+     memcpy(capsule, TOILET_SNAPSHOT_MAGIC, 8);
+     toilet_etch_u32(capsule + 8, SKIBIDI_SNAPSHOT_VERSION);
+     if (ctx->engine) {
+         memset(capsule + 12, 0, 108);
+         toilet_etch_u32(capsule + 12, TOILET_CHACHA_IDENTITY | ctx->engine);
+         for (int word = 0; word < 8; word++) {
+             toilet_etch_u32(capsule + 16 + 4 * word, ctx->chacha_key[word]);
+         }
+         toilet_etch_u64(capsule + 48, ctx->chacha_nonce);
+         toilet_etch_u64(capsule + 120, ctx->call_count);
+         toilet_etch_u64(capsule + 128, toilet_capsule_seal(capsule, 128));
+         return SKIBIDI_SNAPSHOT_SIZE;
+     }
+     toilet_etch_u32(capsule + 12, TOILET_ENGINE_IDENTITY);
+     for (int lane = 0; lane < 4; lane++) {
+         toilet_etch_u64(capsule + 16 + 8 * lane, ctx->rng.s0[lane]);
+         toilet_etch_u64(capsule + 48 + 8 * lane, ctx->rng.s1[lane]);
+         toilet_etch_u64(capsule + 80 + 8 * lane, ctx->rng.buffer[lane]);
+     }
+     toilet_etch_u32(capsule + 112, (uint32_t)ctx->rng.buffer_idx);
+     toilet_etch_u32(capsule + 116, 0);
+     toilet_etch_u64(capsule + 120, ctx->call_count);
+     toilet_etch_u64(capsule + 128, toilet_capsule_seal(capsule, 128));
+ 
+     return SKIBIDI_SNAPSHOT_SIZE;
+ }
+ 
+ /**
+  * @brief Thaw a time capsule back into a toilet
   * 
-  * @note If the buffer runs out mid-production, the toilet gracefully
-  *       stops. No half-dops. No incomplete expressions. The toilet
-  *       has quality standards. The toilet has ISO 9001 certification.
+  * Everything is checked before the context is touched, so a refused
+  * capsule leaves the toilet exactly as it was.
+  * 
+  * @param ctx The toilet to restore into
+  * @param buffer The capsule
+  * @param buffer_size Bytes available
+  * @return SKIBIDI_OK, or a negative error
   */
- int skibidi_generate_batch(SkibidiContext* ctx, char* buffer, 
-                            size_t buffer_size, int count, int* lengths) {
-     if (SKIBIDI_IMPROBABLE(!ctx | !buffer)) return 0;
-     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_MIN_BUFFER_SIZE)) return 0;
-     if (SKIBIDI_IMPROBABLE(count <= 0)) return 0;
+ int skibidi_restore(SkibidiContext* ctx, const void* buffer, size_t buffer_size) {
+     if (SKIBIDI_IMPROBABLE(!ctx || !buffer)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(buffer_size < SKIBIDI_SNAPSHOT_SIZE)) return SKIBIDI_ERR_BUFFER_TOO_SMALL;
+ 
+     const uint8_t* capsule = (const uint8_t*)buffer;
+     const uint32_t identity = toilet_read_u32(capsule + 12);
+     const uint32_t rounds = identity ^ TOILET_CHACHA_IDENTITY;
+     const int chacha = rounds == 8 || rounds == 12 || rounds == 20;
+     if (memcmp(capsule, TOILET_SNAPSHOT_MAGIC, 8) != 0 ||
+         toilet_read_u32(capsule + 8) != SKIBIDI_SNAPSHOT_VERSION ||
+         (identity != TOILET_ENGINE_IDENTITY && !chacha) ||
+         toilet_read_u64(capsule + 128) != toilet_capsule_seal(capsule, 128)) {
+         return SKIBIDI_ERR_CORRUPT_SNAPSHOT;
+     }
  
- #if TOILET_HAS_RIZZ_256
-     if (g_toilet_hivemind.flush_strategy >= 1) {
-         return toilet_factory_avx2(ctx, buffer, buffer_size, count, lengths);
+     if (chacha) {
+         memset(ctx, 0, sizeof(SkibidiContext));
+         ctx->engine = rounds;
+         for (int word = 0; word < 8; word++) {
+             ctx->chacha_key[word] = toilet_read_u32(capsule + 16 + 4 * word);
+         }
+         ctx->chacha_nonce = toilet_read_u64(capsule + 48);
+         ctx->call_count = toilet_read_u64(capsule + 120);
+         return SKIBIDI_OK;
      }
- #endif
  
-     int toilets_flushed = 0;
-     size_t scroll_offset = 0;
+     /* A sealed capsule can still hold a state no toilet could have reached */
+     SkibidiRngState rng;
+     memset(&rng, 0, sizeof(rng));
+     for (int lane = 0; lane < 4; lane++) {
+         rng.s0[lane] = toilet_read_u64(capsule + 16 + 8 * lane);
+         rng.s1[lane] = toilet_read_u64(capsule + 48 + 8 * lane);
+         rng.buffer[lane] = toilet_read_u64(capsule + 80 + 8 * lane);
+         if (!(rng.s0[lane] & 1)) return SKIBIDI_ERR_CORRUPT_SNAPSHOT;
+     }
+     rng.buffer_idx = (int32_t)toilet_read_u32(capsule + 112);
+     if (rng.buffer_idx < 0 || rng.buffer_idx > 4) return SKIBIDI_ERR_CORRUPT_SNAPSHOT;
  
-     for (int soul = 0; soul < count && scroll_offset + SKIBIDI_MIN_BUFFER_SIZE <= buffer_size; soul++) {
-         int inscription_len = toilet_speak_ultra(&ctx->rng, buffer + scroll_offset, 1);
-         if (SKIBIDI_IMPROBABLE(inscription_len < 0)) break;
+     memset(ctx, 0, sizeof(SkibidiContext));
+     ctx->rng = rng;
+     ctx->call_count = toilet_read_u64(capsule + 120);
+     return SKIBIDI_OK;
+ }
  
-         ctx->call_count++;
-         if (lengths) lengths[soul] = inscription_len;
-         buffer[scroll_offset + inscription_len] = '\n';
-         scroll_offset += inscription_len + 1;
-         toilets_flushed++;
-     }
+ /**
+  * @brief Bud a child toilet off a parent in O(1)
+  * 
+  * One quad flush from the parent, each number run through SplitMix64
+  * twice (once per state word) the way skibidi_init() expands a seed.
+  * The child's lanes start far from anything the parent will visit and
+  * the parent, having spent a flush, never buds the same child twice.
+  * 
+  * A ChaCha parent buds a ChaCha child with the same rounds, keyed with
+  * the parent's next two lines of keystream, which the parent skips.
+  * 
+  * @param ctx The parent
+  * @param child The bud
+  * @return SKIBIDI_OK, or a negative error
+  */
+ int skibidi_fork(SkibidiContext* ctx, SkibidiContext* child) {
+     if (SKIBIDI_IMPROBABLE(!ctx || !child)) return SKIBIDI_ERR_NULL_PTR;
+     if (SKIBIDI_IMPROBABLE(ctx == child)) return SKIBIDI_ERR_INVALID_CONFIG;
  
-     return toilets_flushed;
+     toilet_bud(ctx, child);
+     return SKIBIDI_OK;
  }
  
  /**
-  * @brief End the toilet's existence (secure destruction)
+  * @brief Arm or disarm the toilet's stopwatch for every thread
   * 
-  * The toilet's final flush. All memory is overwritten with zeros
-  * using volatile writes so the compiler cannot optimize away the
-  * toilet's death. The RNG state is obliterated. The dop counts
-  * are forgotten. The toilet's consciousness returns to the void.
+  * Each thread times its first instrumented call after the change and
+  * then every sample_every-th one.
   * 
-  * This is important for security because if someone reads the
-  * toilet's RNG state from memory, they could predict future dops.
-  * And in the wrong hands, predicted dops could be... well, actually
-  * they'd just be Skibidi expressions. But the toilet takes OPSEC
-  * seriously. The toilet has read the NIST guidelines.
+  * @param sample_every 0 = off, N = time 1 call in N per thread
+  * @return SKIBIDI_OK
+  */
+ int skibidi_probe_configure(uint32_t sample_every) {
+     atomic_store_explicit(&g_toilet_hivemind.probe_every, sample_every, memory_order_relaxed);
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Copy out the calling thread's histograms
   * 
-  * @param ctx The toilet to destroy (NULL is accepted, even the void is valid)
+  * @param out Where the copy goes
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
+  */
+ int skibidi_probe_snapshot(SkibidiProbeHistogram* out) {
+     if (SKIBIDI_IMPROBABLE(!out)) return SKIBIDI_ERR_NULL_PTR;
+     memcpy(out, &toilet_probe_log.histogram, sizeof(SkibidiProbeHistogram));
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Pour one set of histograms into another
   * 
-  * @note The volatile keyword ensures the compiler doesn't say "lol
-  *       nobody reads this memory after this function, I'll just skip
-  *       the zeroing." NO. The toilet WILL be zeroed. The toilet's
-  *       memory WILL be cleansed. The toilet demands a clean death.
+  * @param into Accumulates the sum
+  * @param from Added to into (unchanged)
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
   */
- void skibidi_destroy(SkibidiContext* ctx) {
-     if (ctx) {
-         volatile uint64_t* porcelain = (volatile uint64_t*)ctx;
-         for (size_t shard = 0; shard < sizeof(SkibidiContext) / sizeof(uint64_t); shard++) {
-             porcelain[shard] = 0;
+ int skibidi_probe_merge(SkibidiProbeHistogram* into, const SkibidiProbeHistogram* from) {
+     if (SKIBIDI_IMPROBABLE(!into || !from)) return SKIBIDI_ERR_NULL_PTR;
+ 
+     for (int point = 0; point < SKIBIDI_PROBE_ENTRY_POINTS; point++) {
+         for (int size_class = 0; size_class < SKIBIDI_PROBE_SIZE_CLASSES; size_class++) {
+             for (int bucket = 0; bucket < SKIBIDI_PROBE_BUCKETS; bucket++) {
+                 into->counts[point][size_class][bucket] += from->counts[point][size_class][bucket];
+             }
+             into->total_ticks[point][size_class] += from->total_ticks[point][size_class];
+             if (from->max_ticks[point][size_class] > into->max_ticks[point][size_class]) {
+                 into->max_ticks[point][size_class] = from->max_ticks[point][size_class];
+             }
          }
      }
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Forget everything the calling thread's stopwatch recorded
+  */
+ void skibidi_probe_reset(void) {
+     memset(&toilet_probe_log.histogram, 0, sizeof(SkibidiProbeHistogram));
+ }
+ 
+ /**
+  * @brief Smallest tick count that lands in a bucket
+  * 
+  * @param bucket 0 .. SKIBIDI_PROBE_BUCKETS - 1
+  * @return The bucket's lower bound, or 0 for an out-of-range bucket
+  */
+ uint64_t skibidi_probe_bucket_floor(int bucket) {
+     if (bucket < 0 || bucket >= SKIBIDI_PROBE_BUCKETS) return 0;
+     if (bucket < 4) return (uint64_t)bucket;
+     const int octave = bucket / 4 + 1;
+     return (uint64_t)(4 + bucket % 4) << (octave - 2);
  }
  
  /**
@@ -1962,7 +7253,7 @@
   * @note Each toilet must be individually initialized with skibidi_init.
   *       The toilets do not share consciousness. Each toilet is its own
   *       universe. Each toilet has its own dop destiny.
-  * @note Use skibidi_free_context to dismiss the entire battalion at once
+  * @note Use skibidi_free_context_array to dismiss the entire battalion at once
   */
  SkibidiContext* skibidi_alloc_context_array(size_t count) {
      if (count == 0) return NULL;
@@ -1986,6 +7277,118 @@
      }
  }
  
+ /**
+  * @brief Release a whole battalion back to the heap
+  * 
+  * skibidi_destroy_array() over every toilet, then one free for the
+  * block skibidi_alloc_context_array() carved out.
+  * 
+  * @param ctxs The battalion (NULL is accepted)
+  * @param count The count it was summoned with
+  */
+ void skibidi_free_context_array(SkibidiContext* ctxs, size_t count) {
+     if (ctxs) {
+         skibidi_destroy_array(ctxs, count);
+         SKIBIDI_ALIGNED_FREE(ctxs);
+     }
+ }
+ 
+ /**
+  * @brief Open a cloakroom of seeded toilets
+  * 
+  * Every slot is budded off one toilet born from seed, so the pool's
+  * streams are as independent as skibidi_fork() children, and the
+  * pool is on the free list in slot order.
+  * 
+  * @param capacity How many toilets can be lent out at once
+  * @param seed Seed of the toilet every slot is budded from
+  * @param[out] out Receives the pool, close with skibidi_pool_destroy()
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, SKIBIDI_ERR_INVALID_CONFIG
+  *         or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ int skibidi_pool_create(size_t capacity, uint64_t seed, SkibidiContextPool** out) {
+     if (SKIBIDI_IMPROBABLE(!out)) return SKIBIDI_ERR_NULL_PTR;
+     *out = NULL;
+     if (SKIBIDI_IMPROBABLE(capacity == 0 || capacity >= UINT32_MAX)) return SKIBIDI_ERR_INVALID_CONFIG;
+ 
+     SkibidiContextPool* pool = (SkibidiContextPool*)SKIBIDI_ALIGNED_ALLOC(64, sizeof(SkibidiContextPool));
+     SkibidiContext* toilets = skibidi_alloc_context_array(capacity);
+     _Atomic uint32_t* links = (_Atomic uint32_t*)malloc(capacity * sizeof(_Atomic uint32_t));
+     if (SKIBIDI_IMPROBABLE(!pool || !toilets || !links)) {
+         free(links);
+         skibidi_free_context_array(toilets, 0);
+         if (pool) SKIBIDI_ALIGNED_FREE(pool);
+         return SKIBIDI_ERR_OUT_OF_MEMORY;
+     }
+ 
+     SkibidiContext mother;
+     skibidi_init(&mother, seed);
+     for (size_t slot = 0; slot < capacity; slot++) {
+         toilet_bud(&mother, &toilets[slot]);
+         atomic_init(&links[slot], (uint32_t)(slot + 2 <= capacity ? slot + 2 : 0));
+     }
+     skibidi_destroy(&mother);
+ 
+     pool->toilets = toilets;
+     pool->links = links;
+     pool->capacity = (uint32_t)capacity;
+     atomic_init(&pool->head, 1);
+     *out = pool;
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Borrow a toilet from the cloakroom (thread-safe, lock-free)
+  * 
+  * The toilet is reborn off its own state on the way out, so it speaks
+  * a stream nobody has heard before, whoever held it last.
+  * 
+  * @param pool The cloakroom
+  * @return A ready toilet, or NULL if pool is NULL or every toilet is lent out
+  */
+ SkibidiContext* skibidi_pool_acquire(SkibidiContextPool* pool) {
+     if (SKIBIDI_IMPROBABLE(!pool)) return NULL;
+     const uint32_t slot = toilet_cloakroom_pop(pool);
+     if (SKIBIDI_IMPROBABLE(!slot)) return NULL;
+ 
+     SkibidiContext* ctx = &pool->toilets[slot - 1];
+     toilet_bud(ctx, ctx);
+     return ctx;
+ }
+ 
+ /**
+  * @brief Hand a borrowed toilet back (thread-safe, lock-free)
+  * 
+  * @param pool The cloakroom it came from
+  * @param ctx The toilet, as skibidi_pool_acquire() returned it
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, or SKIBIDI_ERR_INVALID_CONFIG
+  *         if ctx is not one of this pool's toilets
+  */
+ int skibidi_pool_release(SkibidiContextPool* pool, SkibidiContext* ctx) {
+     if (SKIBIDI_IMPROBABLE(!pool || !ctx)) return SKIBIDI_ERR_NULL_PTR;
+     const uintptr_t offset = (uintptr_t)ctx - (uintptr_t)pool->toilets;
+     if (SKIBIDI_IMPROBABLE(offset % sizeof(SkibidiContext) != 0 ||
+                            offset / sizeof(SkibidiContext) >= pool->capacity)) {
+         return SKIBIDI_ERR_INVALID_CONFIG;
+     }
+ 
+     toilet_cloakroom_push(pool, (uint32_t)(offset / sizeof(SkibidiContext)) + 1);
+     return SKIBIDI_OK;
+ }
+ 
+ /**
+  * @brief Close the cloakroom and wipe every toilet in it (NULL is fine)
+  * 
+  * Toilets still lent out die with the pool.
+  */
+ void skibidi_pool_destroy(SkibidiContextPool* pool) {
+     if (pool) {
+         skibidi_free_context_array(pool->toilets, pool->capacity);
+         free((void*)pool->links);
+         SKIBIDI_ALIGNED_FREE(pool);
+     }
+ }
+ 
  /**
   * @brief Reveal the toilet engine's version string
   * @return The version inscription on the toilet's porcelain base
@@ -2029,10 +7432,10 @@
   */
  const char* skibidi_get_active_simd(void) {
      toilet_vibe_check();
-     switch (g_toilet_hivemind.flush_strategy) {
+     switch (toilet_battle_form()) {
          case 2:  return "AVX-512";
          case 1:  return "AVX2";
-         default: return "Scalar";
+         default: return TOILET_HAS_STRIDE_128 ? "SSE2" : "Scalar";
      }
  }
  
@@ -2042,7 +7445,7 @@
   */
  int skibidi_is_avx512_enabled(void) {
      toilet_vibe_check();
-     return g_toilet_hivemind.flush_strategy == 2;
+     return toilet_battle_form() == 2;
  }
  
  /**
@@ -29,6 +29,27 @@
  extern "C" {
  #endif
  
+ /**
+  * @brief Linkage of every public toilet ritual
+  * 
+  * Empty for the shared and static libraries. skibidi_inline.h sets it
+  * to `static inline` before including this header so the whole engine
+  * compiles into the caller's translation unit and the hot path can be
+  * absorbed into the caller's loops.
+  */
+ #ifndef SKIBIDI_API
+ #define SKIBIDI_API
+ #endif
+ 
+ /** @brief Compile-time toilet inspections, in whichever dialect the caller's compiler speaks */
+ #ifdef __cplusplus
+ #define SKIBIDI_STATIC_ASSERT(cond, msg)  static_assert(cond, msg)
+ #define SKIBIDI_ALIGNOF(type)             alignof(type)
+ #else
+ #define SKIBIDI_STATIC_ASSERT(cond, msg)  _Static_assert(cond, msg)
+ #define SKIBIDI_ALIGNOF(type)             _Alignof(type)
+ #endif
+ 
  /**
   * @defgroup ErrorCodes Toilet Status Codes
   * @brief Return codes indicating the toilet's emotional state after each operation
@@ -38,6 +59,8 @@
  #define SKIBIDI_ERR_NULL_PTR          -1   /**< You pointed at nothing. The toilet stares into the void. */
  #define SKIBIDI_ERR_BUFFER_TOO_SMALL  -2   /**< Your buffer cannot contain the toilet's output. Embarrassing. */
  #define SKIBIDI_ERR_INVALID_CONFIG    -3   /**< The toilet rejects your configuration. Try harder. */
+ #define SKIBIDI_ERR_OUT_OF_MEMORY     -4   /**< The heap's bathroom is full. The toilet could not be summoned. */
+ #define SKIBIDI_ERR_CORRUPT_SNAPSHOT  -5   /**< That memory is not the toilet's. Wrong version, wrong engine, or it rotted in storage. */
  /** @} */
  
  /**
@@ -98,8 +121,8 @@
   * @note 32-byte aligned because the inner toilets demand SIMD-compatible seating
   */
  typedef struct __attribute__((aligned(32))) {
-     uint64_t s0[4];         /**< 4-way parallel toilet consciousness A (Lehmer64 states) */
-     uint64_t s1[4];         /**< 4-way parallel toilet consciousness B (backup states) */
+     uint64_t s0[4];         /**< 4-way parallel toilet consciousness A (Lehmer64 low words) */
+     uint64_t s1[4];         /**< 4-way parallel toilet consciousness B (Lehmer64 high words, must follow s0) */
      uint64_t buffer[4];     /**< Pre-generated random number toilet tank */
      int32_t buffer_idx;     /**< Current dispensing position in the toilet tank [0,4] */
      int32_t _padding;       /**< Alignment padding (the toilet sits level) */
@@ -117,8 +140,12 @@
   * Memory layout (192 bytes = 3 x cache line = 3 toilet thoughts):
   * - SkibidiRngState rng: 128 bytes (2 cache lines of toilet brain)
   * - call_count: 8 bytes (the toilet's lifetime dop odometer)
-  * - reserved[7]: 56 bytes (padding to the 3rd cache line boundary,
-  *   the toilet needs personal space)
+  * - engine, chacha_key, chacha_nonce, chacha_block: 56 bytes, the
+  *   sealed cistern of skibidi_init_chacha() toilets (zero otherwise),
+  *   filling the 3rd cache line
+  * 
+  * A ChaCha toilet keeps no Lehmer64 lanes: rng.s0 and rng.s1 hold the
+  * 64-byte keystream block its current line comes from instead.
   * 
   * Design philosophy:
   * - 64-byte alignment ensures each toilet starts at a cache line boundary
@@ -132,7 +159,11 @@
  typedef struct __attribute__((aligned(SKIBIDI_CACHE_LINE_SIZE))) {
      SkibidiRngState rng;    /**< The toilet's entropy brain (128 bytes, 2 cache lines) */
      uint64_t call_count;    /**< How many times this toilet has spoken (lifetime dop counter) */
-     uint64_t reserved[7];   /**< The toilet's reserved meditation space (56 bytes to fill 3rd cache line) */
+     uint32_t engine;        /**< Entropy engine: 0 = Lehmer64 lanes, 8/12/20 = ChaCha with that many rounds */
+     uint32_t _engine_padding; /**< Alignment padding (the cistern sits level) */
+     uint32_t chacha_key[8]; /**< ChaCha key words (ChaCha toilets only) */
+     uint64_t chacha_nonce;  /**< ChaCha nonce, the stream within the key */
+     uint64_t chacha_block;  /**< Keystream block cached in rng.s0/s1, plus one (0 = none yet) */
  } SkibidiContext;
  
  /**
@@ -142,7 +173,7 @@
   * Check your compiler's struct packing settings immediately. The toilet
   * community is counting on you.
   */
- _Static_assert(sizeof(SkibidiContext) == 192, 
+ SKIBIDI_STATIC_ASSERT(sizeof(SkibidiContext) == 192,
      "SkibidiContext must be exactly 192 bytes (3 cache lines)");
  
  /**
@@ -152,20 +183,87 @@
   * If this assertion fires, someone has tampered with the toilet's
   * alignment attributes. Find them. Stop them. The dops depend on it.
   */
- _Static_assert(_Alignof(SkibidiContext) == 64,
+ SKIBIDI_STATIC_ASSERT(SKIBIDI_ALIGNOF(SkibidiContext) == 64,
      "SkibidiContext must be 64-byte aligned (cache line)");
  
+ /**
+  * @brief A pocket toilet: one Lehmer64 stream in 16 bytes
+  * 
+  * For populations of millions of independent streams, where a full
+  * SkibidiContext (192 bytes, 3 cache lines) per stream is too much.
+  * Just the 128-bit Lehmer64 state: no call counter (there is no room
+  * left in 16 bytes, count lines on your side if you need to), no batch
+  * lanes. Seed with skibidi_init_lite_array(), speak with
+  * skibidi_generate_lite().
+  */
+ typedef struct __attribute__((aligned(16))) {
+     uint64_t s0;            /**< Lehmer64 low word (always odd) */
+     uint64_t s1;            /**< Lehmer64 high word */
+ } SkibidiLiteState;
+ 
+ SKIBIDI_STATIC_ASSERT(sizeof(SkibidiLiteState) == 16,
+     "SkibidiLiteState must be exactly 16 bytes (four to a cache line)");
+ 
  /**
   * @brief Global Toilet Behavior Configuration
   * 
   * Controls the toilet's runtime behavior. The mortal may use this
   * to enable or disable various toilet dimensions. The toilet
   * respects the mortal's wishes (mostly).
+  * 
+  * By default each kernel draws its entropy the fastest way it knows:
+  * single calls and the one-stall factory from lane 0 alone, the AVX2
+  * and SSE2 factories from all four lanes, so the same seed gives
+  * different text on different builds, batch sizes and call mixes.
+  * With canonical_stream set, every kernel speaks the canonical stream
+  * instead, byte for byte:
+  * 
+  * - Line n of a context (n = its call_count before the line) belongs
+  *   to lane n % 4, which flushes twice: e1 = step(s0/s1[n % 4]), then
+  *   e2 = step(s0/s1[n % 4]), whether or not the line is the prophecy
+  * - e1[55:48] < 69 is the prophecy, otherwise the line is written from
+  *   e1 (census [63:56], vibration [55:48], verdict [39:32]) and e2
+  *   (disguises [31:0], zodiacs [39:20] for the first four dops, ending
+  *   cases [59:40]); the fifth dop is always lowercase or "dom"
+  * - Variant calls and batches write that same line for the prophecy
+  *   too; elided batches leave it out
+  * - Dialects draw the same way and decide with their own codex (the
+  *   16-bit prophecy vibe e1[55:48]:e1[23:16]), like their AVX2 factory
+  * 
+  * That is what the four-lane factories always did in their aligned
+  * groups, so they keep their speed; only single calls and the lines
+  * around a batch's edges change. So does the phrase's distribution:
+  * vibration shares the prophecy byte and needs it below 38, and every
+  * such line is already the prophecy, so skibidi_generate() and plain
+  * batches never start a line with "Brrrrr" (about 11% of default
+  * single calls do; variant calls and batches still can), and no fifth
+  * dop changes case. Plain batches never had either. Single calls,
+  * batches of any size and any split, scalar, SSE2, AVX2 and AVX-512
+  * builds, skibidi_get_generator() handles and the tuned batch table
+  * all agree. Pocket toilets
+  * (SkibidiLiteState) have one lane and already speak one stream
+  * everywhere; skibidi_speak_raw() keeps no call_count and stays lane 0.
+  * 
+  * constant_time speaks the canonical stream (it turns canonical_stream
+  * on) through a kernel with no branch, table index or store address
+  * that depends on the line: the prophecy, dop count, verdict and case
+  * variants are all decided with masks and every line stores the same
+  * 48 bytes, so cache and branch timing cannot tell "yes yes!"
+  * from "no no!" before the caller reads the text. It covers
+  * skibidi_generate(), skibidi_generate_variant(), the built-in batches
+  * (int, 64-bit, elided, UTF-16, readers), skibidi_generate_each() and
+  * skibidi_get_generator() handles. Dialects, hot-line records and
+  * pocket toilets keep their ordinary kernels. The line lengths are the
+  * output and are not hidden. Costs up to 2x a canonical line
+  * (about 1.9x for single calls, 1.6x in batches).
   */
  typedef struct {
      int32_t enable_avx512;      /**< Allow the toilet to enter 512-bit god mode? (1=yes, 0=no, even if hardware supports it the toilet will hold back) */
      int32_t enable_simd_rng;    /**< Allow the 4 inner toilets to flush simultaneously? (1=yes, 0=one at a time like peasants) */
-     int32_t reserved[6];        /**< Reserved toilet settings for future DLC (downloadable toilet content) */
+     int32_t autotune;           /**< Race the batch kernels now, like skibidi_autotune(NULL, NULL)? (1=yes, 0=trust CPUID) */
+     int32_t canonical_stream;   /**< Speak the canonical stream on every kernel? (1=same text everywhere, 0=fastest, differs per kernel) */
+     int32_t constant_time;      /**< Speak it in constant time? (1=no timing tells, implies canonical_stream, 0=normal kernels) */
+     int32_t reserved[3];        /**< Reserved toilet settings for future DLC (downloadable toilet content) */
  } SkibidiConfig;
  
  /**
@@ -201,14 +299,55 @@
   * }
   * @endcode
   */
- int skibidi_init(SkibidiContext* ctx, uint64_t seed);
+ SKIBIDI_API int skibidi_init(SkibidiContext* ctx, uint64_t seed);
+ 
+ /** @brief Bytes in a ChaCha key */
+ #define SKIBIDI_CHACHA_KEY_SIZE  32
+ 
+ /**
+  * @brief Bring a toilet into existence on a ChaCha keystream
+  * 
+  * For toilets whose lines reach people who should not be able to
+  * predict the next one: Lehmer64 gives its state away after a handful
+  * of lines, ChaCha does not. Line n of the toilet is spoken from bytes
+  * 16n to 16n + 15 of the ChaCha keystream (64-bit block counter,
+  * 64-bit nonce, the original layout) read as two little-endian words,
+  * so the same key and nonce give the same text on every CPU, build,
+  * batch size and mix of single and batch calls, the way
+  * canonical_stream does for Lehmer64 toilets.
+  * 
+  * Every entry point that takes a context honors it: singles, variants,
+  * all batches, dialects, UTF-16, records, hot lines, readers,
+  * skibidi_generate_each() and skibidi_get_generator() handles, and
+  * constant_time (ChaCha has no secret-dependent branches of its own).
+  * Batches run 4, 8 or 16 blocks at once through SSE2, AVX2 or AVX-512;
+  * single calls share one cached block per four lines. skibidi_snapshot()
+  * and skibidi_restore() carry the key, skibidi_fork() keys the child
+  * with the parent's next two lines of keystream (the parent skips
+  * them). skibidi_speak_raw() knows nothing of ChaCha: do not hand it a
+  * ChaCha toilet's rng.
+  * 
+  * ChaCha8 batches run at about 0.8x Lehmer64 batch throughput with
+  * AVX2 and 0.95x with AVX-512 (0.6x on SSE2-only builds); single calls
+  * compute their block alone and cost about 2x.
+  * 
+  * @param ctx The vessel
+  * @param key SKIBIDI_CHACHA_KEY_SIZE secret bytes, one key per tenant
+  * @param nonce Which stream of the key (give toilets sharing a key different ones)
+  * @param rounds 8, 12 or 20 (ChaCha8 is the fast one and plenty here)
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR or SKIBIDI_ERR_INVALID_CONFIG for other rounds
+  */
+ SKIBIDI_API int skibidi_init_chacha(SkibidiContext* ctx, const uint8_t key[SKIBIDI_CHACHA_KEY_SIZE],
+                                     uint64_t nonce, int rounds);
  
  /**
   * @brief Reconfigure the global toilet (all toilets feel this)
   * 
   * Changes take effect on the next dop generation call. Thread-safe
-  * because the toilet uses atomic operations. The toilet is a
-  * concurrent data structure. The toilet took CS 341.
+  * because the whole configuration is one versioned atomic word: a call
+  * already flushing finishes under the settings it started with, and
+  * nobody waits for anybody. The toilet is a concurrent data structure.
+  * The toilet took CS 341.
   * 
   * @param config The mortal's configuration wishes
   * @return SKIBIDI_OK if the toilet accepted the new rules,
@@ -222,7 +361,7 @@
   * skibidi_configure(&cfg);
   * @endcode
   */
- int skibidi_configure(const SkibidiConfig* config);
+ SKIBIDI_API int skibidi_configure(const SkibidiConfig* config);
  
  /**
   * @brief Ask the toilet what settings it's currently running
@@ -232,7 +371,41 @@
   * @param config Where the toilet writes its current settings
   * @return SKIBIDI_OK on success, SKIBIDI_ERR_NULL_PTR if you gave it nowhere to write
   */
- int skibidi_get_config(SkibidiConfig* config);
+ SKIBIDI_API int skibidi_get_config(SkibidiConfig* config);
+ 
+ /** @brief Batch-size classes the tuner decides for: 1, 2-64, 65-4096, more lines */
+ #define SKIBIDI_TUNE_CLASSES 4
+ 
+ /**
+  * @brief What skibidi_autotune() decided
+  */
+ typedef struct {
+     int32_t forms[SKIBIDI_TUNE_CLASSES];                /**< Battle form per class: 0 = SSE2/walk, 1 = AVX2 */
+     uint64_t ticks_per_kline[SKIBIDI_TUNE_CLASSES][2];  /**< Best ticks per 1024 lines, [class][form], 0 = not raced */
+     int32_t from_cache;                                 /**< 1 if the table came from the cache file */
+     int32_t _reserved;                                  /**< Keeps the toilet level */
+ } SkibidiTuning;
+ 
+ /**
+  * @brief Race the batch kernels and keep the fastest per batch size
+  * 
+  * CPUID says what the toilet can do, not what it does fastest: wide
+  * units that downclock or are double-pumped, hybrid cores and the setup
+  * cost of small batches all move the crossover. This times every batch
+  * kernel that produces the same lines (a few milliseconds) and from then
+  * on every built-in batch runs the one that won for its size. Output is
+  * unchanged, only speed.
+  * 
+  * The table lasts until the next skibidi_configure(), which also runs
+  * it when SkibidiConfig.autotune is set.
+  * 
+  * @param cache_path Optional file: loaded instead of measuring when it
+  *                   was written on this CPU by this build, written after
+  *                   measuring otherwise (write failures are ignored)
+  * @param[out] result Optional report of the decision
+  * @return SKIBIDI_OK or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ SKIBIDI_API int skibidi_autotune(const char* cache_path, SkibidiTuning* result);
  
  /** @} */
  
@@ -258,7 +431,7 @@
   * @return Number of bytes written (the length of the toilet's message),
   *         or negative error code if the toilet is displeased
   */
- int skibidi_generate(SkibidiContext* ctx, char* buffer, size_t buffer_size);
+ SKIBIDI_API int skibidi_generate(SkibidiContext* ctx, char* buffer, size_t buffer_size);
  
  /**
   * @brief Generate a variant expression (the toilet is forced to be creative)
@@ -273,7 +446,30 @@
   * @param buffer_size Canvas size (minimum SKIBIDI_MIN_BUFFER_SIZE bytes)
   * @return Bytes written, or negative error code (the toilet had a bad day)
   */
- int skibidi_generate_variant(SkibidiContext* ctx, char* buffer, size_t buffer_size);
+ SKIBIDI_API int skibidi_generate_variant(SkibidiContext* ctx, char* buffer, size_t buffer_size);
+ 
+ /**
+  * @brief The bare hot path: one line, no questions asked
+  * 
+  * skibidi_generate() without the argument checks, the call_count
+  * increment or the awakening check. Meant for skibidi_inline.h builds,
+  * where it is absorbed into the caller's loop; copy ctx->rng into a
+  * local so the toilet's consciousness can stay in registers:
+  * 
+  * @code
+  * SkibidiRngState rng = ctx.rng;
+  * for (size_t i = 0; i < n; i++) {
+  *     out += skibidi_speak_raw(&rng, out);
+  *     *out++ = '\n';
+  * }
+  * ctx.rng = rng;
+  * @endcode
+  * 
+  * @param rng State of a context that went through skibidi_init()
+  * @param buffer At least SKIBIDI_MIN_BUFFER_SIZE writable bytes
+  * @return Bytes written
+  */
+ SKIBIDI_API int skibidi_speak_raw(SkibidiRngState* rng, char* buffer);
  
  /**
   * @brief Mass toilet production: generate many expressions at once
@@ -291,8 +487,821 @@
   *                length (may be NULL if the mortal doesn't care about individual lengths)
   * @return Actual number of expressions produced (may be less if warehouse filled up)
   */
- int skibidi_generate_batch(SkibidiContext* ctx, char* buffer, 
-                            size_t buffer_size, int count, int* lengths);
+ SKIBIDI_API int skibidi_generate_batch(SkibidiContext* ctx, char* buffer, 
+                                        size_t buffer_size, int count, int* lengths);
+ 
+ /**
+  * @brief skibidi_generate_batch() where every line is a variant
+  * 
+  * The batch form of skibidi_generate_variant(): lines that would have
+  * been the prophecy are spoken as variants from the same entropy, so
+  * the Java layer can run its own prophecy check without the batch
+  * undercutting it.
+  * 
+  * @return Lines produced (same contract as skibidi_generate_batch())
+  */
+ SKIBIDI_API int skibidi_generate_batch_variant(SkibidiContext* ctx, char* buffer,
+                                                size_t buffer_size, int count, int* lengths);
+ 
+ /**
+  * @brief skibidi_generate_batch() with the prophecy left to the caller
+  * 
+  * The same lines skibidi_generate_batch() would produce from the same
+  * state, except that prophecy lines are not written: bit i of
+  * prophecy_bitmap (word i / 64, bit i % 64) is set instead, and
+  * lengths[i] is 0. Only the other lines are in buffer, newline-separated.
+  * The JVM side hands out one interned "Skibidi dop dop yes yes!" for
+  * every set bit and skips ~27% of the bytes it would have decoded.
+  * 
+  * @code
+  * for (int i = 0, at = 0; i < made; i++) {
+  *     if (bitmap[i >> 6] >> (i & 63) & 1) emit(PROPHECY);
+  *     else { emit_bytes(buffer + at, lengths[i]); at += lengths[i] + 1; }
+  * }
+  * @endcode
+  * 
+  * @param prophecy_bitmap (count + 63) / 64 words, overwritten
+  * @return Lines produced, prophecies included (0 if lengths or prophecy_bitmap is NULL)
+  */
+ SKIBIDI_API int skibidi_generate_batch_elided(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                               int count, int* lengths, uint64_t* prophecy_bitmap);
+
+ /** @brief skibidi_generate_batch64() flag: 32-bit offsets relative to this call's buffer */
+ #define SKIBIDI_BATCH_OFFSETS_REL32  0x1u
+ 
+ /**
+  * @brief Where a sequence of skibidi_generate_batch64() calls has got to
+  * 
+  * Zero it before the first call. Each call adds what it produced, so
+  * lines/bytes are the totals across the whole output.
+  */
+ typedef struct {
+     uint64_t lines;         /**< Lines produced so far */
+     uint64_t bytes;         /**< Bytes produced so far (absolute offset of the next line) */
+ } SkibidiCursor;
+ 
+ /**
+  * @brief Mass toilet production with 64-bit counts and an offsets column
+  * 
+  * Newline-separated like skibidi_generate_batch(). Instead of lengths,
+  * offsets receives count + 1 entries: the start of every line plus the
+  * end of the output, so line i is found in O(1) without a prefix sum.
+  * 
+  * @param ctx The factory foreman toilet
+  * @param buffer Output window (at least SKIBIDI_MIN_BUFFER_SIZE per line while written)
+  * @param buffer_size Window size in bytes
+  * @param count Lines wanted from this call
+  * @param offsets Optional offsets column: uint64_t absolute offsets (cursor->bytes + position),
+  *                or uint32_t offsets relative to buffer with SKIBIDI_BATCH_OFFSETS_REL32
+  * @param flags 0 or SKIBIDI_BATCH_OFFSETS_REL32 (unknown flags produce nothing)
+  * @param cursor Optional resume point, advanced by this call (NULL = offsets start at 0)
+  * @return Lines produced; fewer than count means the window filled up
+  * 
+  * @code
+  * SkibidiCursor cur = {0};
+  * while (cur.lines < total) {
+  *     char* window = map + cur.bytes;
+  *     if (!skibidi_generate_batch64(&ctx, window, map_size - cur.bytes,
+  *                                   total - cur.lines, offsets + cur.lines, 0, &cur)) {
+  *         break;  // the map is full, grow it and resume from cur
+  *     }
+  * }
+  * @endcode
+  */
+ SKIBIDI_API uint64_t skibidi_generate_batch64(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                                               uint64_t count, void* offsets, uint32_t flags,
+                                               SkibidiCursor* cursor);
+ 
+ /**
+  * @brief One line from each of n toilets, in one call
+  * 
+  * Line i is exactly what skibidi_generate(&ctxs[i], ...) would have
+  * said, newline-terminated. The per-call checks and the hivemind
+  * lookup happen once for the whole roll call instead of once per
+  * toilet (~15% per line for a simulation tick over many entities).
+  * 
+  * @param ctxs Contiguous contexts (e.g. from skibidi_alloc_context_array()), each advanced by one line
+  * @param n How many contexts
+  * @param buffer Output (at least SKIBIDI_MIN_BUFFER_SIZE per line while written)
+  * @param buffer_size Buffer size in bytes
+  * @param offsets Optional, n + 1 entries: where each line starts, then the end of the output
+  * @return Contexts that spoke; fewer than n means the buffer filled up (0 on NULL ctxs/buffer)
+  */
+ SKIBIDI_API size_t skibidi_generate_each(SkibidiContext* ctxs, size_t n, char* buffer, size_t buffer_size,
+                                          uint64_t* offsets);
+ 
+ /**
+  * @brief One request of a skibidi_generate_scatter() call
+  */
+ typedef struct {
+     char* buffer;           /**< Where this request's lines go, newline-separated */
+     size_t buffer_size;     /**< Its capacity (a line is written only while SKIBIDI_MIN_BUFFER_SIZE bytes are free) */
+     size_t count;           /**< Lines wanted */
+     int* lengths;           /**< Optional: receives each line's length (count entries), or NULL */
+     size_t produced;        /**< Set by the call: lines written */
+     size_t used;            /**< Set by the call: bytes written, newlines included */
+ } SkibidiIoVec;
+ 
+ /**
+  * @brief Fill many small buffers in one call, at batch speed
+  * 
+  * The requests are served in order from one stream, as if their lines
+  * came from a single skibidi_generate_batch() call and were then dealt
+  * out: request 0 gets the first lines, request 1 the next ones, and so
+  * on. Requests of 1-20 lines run through the four-lane batch kernels
+  * together instead of each taking the one-line tail.
+  * 
+  * A request whose buffer fills up gets fewer lines (produced < count)
+  * and the stream carries on with the next request; give each request
+  * SKIBIDI_MIN_BUFFER_SIZE bytes per line to make sure it gets all of
+  * them. With that much room the lines are exactly those of one batch
+  * of the total; tighter requests may regroup lines into different
+  * four-lane groups (the canonical stream never depends on grouping).
+  * 
+  * @param ctx The factory foreman toilet
+  * @param reqs The requests; produced and used are overwritten
+  * @param n How many requests
+  * @return Lines written over all requests (0 on NULL ctx/reqs)
+  */
+ SKIBIDI_API size_t skibidi_generate_scatter(SkibidiContext* ctx, SkibidiIoVec* reqs, size_t n);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup LiteAPI Pocket Toilets
+  * @brief Millions of 16-byte streams
+  * @{
+  */
+ 
+ /**
+  * @brief Seed n pocket toilets at once
+  * 
+  * State i gets the same SplitMix64 expansion skibidi_init() gives lane
+  * i of a context, so with the default stream states[0] speaks exactly
+  * what skibidi_generate() would for a context initialized with the same
+  * seed. Under canonical_stream or constant_time skibidi_generate()
+  * follows the canonical lane schedule and the two part ways within the
+  * first few lines. Runs 8 states per step with AVX-512, 4 with AVX2.
+  * 
+  * @param states Where the states go (n * 16 bytes)
+  * @param n How many
+  * @param seed The population's seed
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
+  */
+ SKIBIDI_API int skibidi_init_lite_array(SkibidiLiteState* states, size_t n, uint64_t seed);
+ 
+ /**
+  * @brief Seed states first .. first + n - 1 of a population
+  * 
+  * State i only depends on the seed and i, so threads can seed disjoint
+  * ranges of one big array in parallel:
+  * 
+  * @code
+  * // thread t of T
+  * size_t first = total * t / T, last = total * (t + 1) / T;
+  * skibidi_init_lite_range(states + first, first, last - first, seed);
+  * @endcode
+  * 
+  * @param states Where state first goes (n * 16 bytes)
+  * @param first Population index of states[0]
+  * @param n How many
+  * @param seed The population's seed
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
+  */
+ SKIBIDI_API int skibidi_init_lite_range(SkibidiLiteState* states, uint64_t first, size_t n, uint64_t seed);
+ 
+ /**
+  * @brief skibidi_generate() for a pocket toilet
+  * 
+  * @param state The stream (advanced by the call)
+  * @param buffer At least SKIBIDI_MIN_BUFFER_SIZE bytes
+  * @param buffer_size Buffer size
+  * @return Bytes written, or a negative error code
+  */
+ SKIBIDI_API int skibidi_generate_lite(SkibidiLiteState* state, char* buffer, size_t buffer_size);
+ 
+ /**
+  * @brief skibidi_generate_each() for a population of pocket toilets
+  * 
+  * @param states The population, each advanced by one line
+  * @param n How many states
+  * @param buffer Output (at least SKIBIDI_MIN_BUFFER_SIZE per line while written)
+  * @param buffer_size Buffer size in bytes
+  * @param offsets Optional, n + 1 entries: where each line starts, then the end of the output
+  * @return States that spoke; fewer than n means the buffer filled up
+  */
+ SKIBIDI_API size_t skibidi_generate_each_lite(SkibidiLiteState* states, size_t n, char* buffer,
+                                               size_t buffer_size, uint64_t* offsets);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup HandleAPI Pre-Resolved Toilet Handles
+  * @brief Ask once which kernel to call, then call it directly
+  * 
+  * Every skibidi_generate*() call checks its arguments, makes sure the
+  * toilet is awake and asks the hivemind which battle form to use. For
+  * callers whose every call already pays a toll (Java FFM downcalls),
+  * skibidi_get_generator() does the asking once and hands back the
+  * kernel built for this CPU and the current configuration.
+  * 
+  * @code
+  * SkibidiGenerateFn speak = (SkibidiGenerateFn)skibidi_get_generator(SKIBIDI_GEN_SINGLE, 0);
+  * int len = speak(&ctx, buffer, sizeof(buffer));
+  * @endcode
+  * 
+  * The kernels never call back, block or allocate, so the JVM may bind
+  * them with Linker.Option.critical(false).
+  * @{
+  */
+ 
+ #define SKIBIDI_GEN_SINGLE   0   /**< SkibidiGenerateFn, same contract as skibidi_generate() */
+ #define SKIBIDI_GEN_VARIANT  1   /**< SkibidiGenerateFn, same contract as skibidi_generate_variant() */
+ #define SKIBIDI_GEN_BATCH    2   /**< SkibidiBatchFn, same contract as skibidi_generate_batch() */
+ 
+ /**
+  * @brief Skip argument checks entirely
+  * 
+  * The caller promises a non-NULL context and buffer, buffer_size of at
+  * least SKIBIDI_MIN_BUFFER_SIZE and, for SKIBIDI_GEN_BATCH, count > 0.
+  * Break the promise and the toilet writes wherever you pointed it.
+  */
+ #define SKIBIDI_GEN_TRUSTED  0x1u
+ 
+ /** @brief Signature of SKIBIDI_GEN_SINGLE and SKIBIDI_GEN_VARIANT handles */
+ typedef int (*SkibidiGenerateFn)(SkibidiContext* ctx, char* buffer, size_t buffer_size);
+ 
+ /** @brief Signature of SKIBIDI_GEN_BATCH handles */
+ typedef int (*SkibidiBatchFn)(SkibidiContext* ctx, char* buffer, size_t buffer_size,
+                               int count, int* lengths);
+ 
+ /** @brief What skibidi_get_generator() returns; cast it to the kind's signature */
+ typedef void (*SkibidiGeneratorFn)(void);
+ 
+ /**
+  * @brief Fetch the kernel for one kind of generation
+  * 
+  * The handle reflects the configuration at the time of the call: fetch
+  * again after skibidi_configure() to follow it. Older handles remain
+  * safe to call, they just keep their old battle form.
+  * 
+  * @param kind SKIBIDI_GEN_SINGLE, SKIBIDI_GEN_VARIANT or SKIBIDI_GEN_BATCH
+  * @param flags 0 or SKIBIDI_GEN_TRUSTED
+  * @return The kernel, or NULL for an unknown kind or flag
+  */
+ SKIBIDI_API SkibidiGeneratorFn skibidi_get_generator(int kind, uint32_t flags);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup GrammarAPI Custom Toilet Dialects
+  * @brief Teach the toilet new words without forking the porcelain
+  * 
+  * A grammar describes the shape of every line the built-in phrase uses:
+  * 
+  *   [prophecy]                                   (whole-line fast path)
+  *   [prefix ' '] head ' ' chant (' ' chant){0,4} ' ' verdict ' ' verdict ending
+  * 
+  * where verdict is either the approval or the rejection word. The spec
+  * is compiled once by skibidi_grammar_compile() into the same aligned
+  * word tables, 8-byte word slots and precomputed ending templates the
+  * built-in kernels use, so custom dialects run through the same
+  * branch-light code instead of a general-purpose templating layer.
+  * 
+  * Probabilities in the spec use the same 8-bit codex as the built-in
+  * phrase (threshold / 256); see DistributionAPI for 16-bit tuning after
+  * compilation. Each chant word becomes its alternate with
+  * probability 1/8, exactly like the dop putting on its dom disguise.
+  * @{
+  */
+ 
+ /** @brief Longest word a slot may hold (one 8-byte store with room for the seat) */
+ #define SKIBIDI_GRAMMAR_MAX_WORD      7
+ 
+ /** @brief Maximum number of case forms per word slot */
+ #define SKIBIDI_GRAMMAR_MAX_CASES     8
+ 
+ /** @brief Longest prophecy line a grammar may recite */
+ #define SKIBIDI_GRAMMAR_MAX_PROPHECY  63
+ 
+ /**
+  * @brief One word slot of a grammar (the chant, the approval or the rejection)
+  * 
+  * When cases is NULL the case forms are derived from word the same way
+  * the built-in tables were carved: the first, middle and last letters
+  * are capitalized in the order "x", "Xxx", "xXx", "xxX", "XXx", "XxX",
+  * "xXX", "XXX" (4 forms for 2-letter words, 2 forms for 1-letter words).
+  */
+ typedef struct {
+     const char* word;              /**< Lowercase base form, 1..SKIBIDI_GRAMMAR_MAX_WORD bytes */
+     const char* alternate;         /**< Disguise form of the same length (the "dom"), NULL for none. Chant slot only. */
+     const char* const* cases;      /**< Optional explicit case table (case_count entries, same length as word) */
+     int32_t case_count;            /**< Entries in cases (1..SKIBIDI_GRAMMAR_MAX_CASES), ignored when cases is NULL */
+ } SkibidiWordSlot;
+ 
+ /**
+  * @brief The mortal's description of a new toilet dialect
+  * 
+  * Fill it by hand or start from skibidi_grammar_builtin_spec() and
+  * change only the words you care about.
+  */
+ typedef struct {
+     const char* prophecy;          /**< Whole-line fast path, NULL to disable (max SKIBIDI_GRAMMAR_MAX_PROPHECY bytes) */
+     const char* prefix;            /**< Optional vibration prefix without trailing space, NULL to disable */
+     const char* head;              /**< Always-present head word without trailing space (max 15 bytes) */
+     SkibidiWordSlot chant;         /**< The repeated word (the dop) */
+     SkibidiWordSlot approval;      /**< Doubled verdict on approval (the yes) */
+     SkibidiWordSlot rejection;     /**< Doubled verdict on rejection (the no) */
+     const char* ending;            /**< Terminator glued to the last verdict word (max 7 bytes, may be "") */
+     uint8_t prophecy_threshold;    /**< P(prophecy) * 256 */
+     uint8_t prefix_threshold;      /**< P(prefix) * 256 */
+     uint8_t rejection_threshold;   /**< P(rejection) * 256 */
+     uint8_t repeat_cuts[4];        /**< Repeat count = 1 + number of cuts the 8-bit census exceeds (ascending) */
+     uint8_t _reserved;             /**< Keeps the toilet level */
+ } SkibidiGrammarSpec;
+ 
+ /**
+  * @brief A compiled dialect (opaque, immutable, shareable between threads)
+  */
+ typedef struct SkibidiGrammar SkibidiGrammar;
+ 
+ /**
+  * @brief Fill a spec with the built-in vocabulary and probabilities
+  * 
+  * Compiling this spec unchanged yields a grammar whose single-call
+  * output is byte-identical to skibidi_generate() for the same seed.
+  * 
+  * @param spec Where the sacred scripture is copied (NULL is ignored)
+  */
+ SKIBIDI_API void skibidi_grammar_builtin_spec(SkibidiGrammarSpec* spec);
+ 
+ /**
+  * @brief Compile a dialect into aligned lookup tables
+  * 
+  * All validation happens here so the generate calls stay check-free.
+  * 
+  * @param spec The dialect description (strings are copied, spec may be freed afterwards)
+  * @param[out] out Receives the compiled grammar, release with skibidi_grammar_free()
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, SKIBIDI_ERR_INVALID_CONFIG if a word
+  *         is empty/too long/mismatched or cuts are not ascending,
+  *         SKIBIDI_ERR_OUT_OF_MEMORY if the heap is full
+  */
+ SKIBIDI_API int skibidi_grammar_compile(const SkibidiGrammarSpec* spec, SkibidiGrammar** out);
+ 
+ /**
+  * @brief Release a compiled grammar (NULL is fine)
+  */
+ SKIBIDI_API void skibidi_grammar_free(SkibidiGrammar* grammar);
+ 
+ /**
+  * @brief Per-line buffer requirement of a grammar
+  * 
+  * Like SKIBIDI_MIN_BUFFER_SIZE but for the dialect: the longest line
+  * plus the room the kernels' wide stores may touch past its end.
+  * 
+  * @param grammar The compiled dialect (NULL = built-in phrase)
+  * @return Minimum buffer_size for single calls and per-line batch reserve
+  */
+ SKIBIDI_API size_t skibidi_grammar_buffer_size(const SkibidiGrammar* grammar);
+ 
+ /**
+  * @brief skibidi_generate() speaking a custom dialect
+  * 
+  * @param ctx The toilet that shall speak
+  * @param grammar Compiled dialect (NULL = built-in phrase, same as skibidi_generate())
+  * @param buffer Output buffer
+  * @param buffer_size At least skibidi_grammar_buffer_size(grammar) bytes
+  * @return Bytes written, or negative error code
+  */
+ SKIBIDI_API int skibidi_generate_grammar(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                          char* buffer, size_t buffer_size);
+ 
+ /**
+  * @brief skibidi_generate_variant() speaking a custom dialect (never the prophecy)
+  */
+ SKIBIDI_API int skibidi_generate_grammar_variant(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                                  char* buffer, size_t buffer_size);
+ 
+ /**
+  * @brief skibidi_generate_batch() speaking a custom dialect
+  * 
+  * Same newline-separated output and return convention as
+  * skibidi_generate_batch(). Each line reserves
+  * skibidi_grammar_buffer_size(grammar) bytes while it is being written.
+  */
+ SKIBIDI_API int skibidi_generate_batch_grammar(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                                char* buffer, size_t buffer_size, int count, int* lengths);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup DistributionAPI Tunable Toilet Probabilities
+  * @brief Change the toilet's mood without recompiling the toilet
+  * 
+  * Every probability the built-in phrase hard-codes, at 16-bit precision.
+  * A distribution is validated and baked into a grammar's thresholds,
+  * SIMD broadcast constants and zodiac charts when it is set, so the
+  * kernels keep doing plain compare-and-add. To tune the built-in phrase,
+  * compile skibidi_grammar_builtin_spec() and set a distribution on it.
+  * 
+  * Thresholds that are multiples of 256 decide exactly like the 8-bit
+  * codex they replace: the default distribution reproduces the built-in
+  * output byte for byte.
+  * @{
+  */
+ 
+ /** @brief Case weights are expressed in 32nds of the zodiac */
+ #define SKIBIDI_CASE_WEIGHT_TOTAL  32
+ 
+ /**
+  * @brief The toilet's complete probability codex (16-bit precision)
+  */
+ typedef struct {
+     uint16_t prophecy;          /**< P(prophecy line) * 65536 */
+     uint16_t prefix;            /**< P(vibration prefix) * 65536 */
+     uint16_t rejection;         /**< P(rejection verdict) * 65536 */
+     uint16_t repeat_cuts[4];    /**< Ascending; chant count = 1 + number of cuts the 16-bit census exceeds */
+     uint16_t _reserved;         /**< Must be zero (the toilet's future plans) */
+     uint8_t case_weights[8];    /**< Zodiac sign weights in 32nds, must sum to 32 (sign 0 = lowercase) */
+ } SkibidiDistribution;
+ 
+ /**
+  * @brief Fill a distribution with the built-in probabilities
+  */
+ SKIBIDI_API void skibidi_distribution_default(SkibidiDistribution* dist);
+ 
+ /**
+  * @brief Validate and bake a distribution into a grammar
+  * 
+  * Not safe against concurrent generation with the same grammar;
+  * compile a second grammar for live A/B switches.
+  * 
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR or SKIBIDI_ERR_INVALID_CONFIG
+  */
+ SKIBIDI_API int skibidi_grammar_set_distribution(SkibidiGrammar* grammar, const SkibidiDistribution* dist);
+ 
+ /**
+  * @brief Read back a grammar's distribution (NULL grammar = built-in defaults)
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
+  */
+ SKIBIDI_API int skibidi_grammar_get_distribution(const SkibidiGrammar* grammar, SkibidiDistribution* dist);
+ 
+ /**
+  * @brief Expected line length in bytes (without separator) for buffer sizing
+  * 
+  * @param dist Probabilities (NULL = the grammar's own)
+  * @param grammar Vocabulary (NULL = built-in phrase)
+  * @return Expected bytes per line, negative if dist is invalid
+  */
+ SKIBIDI_API double skibidi_distribution_expected_length(const SkibidiDistribution* dist, const SkibidiGrammar* grammar);
+ 
+ /** @} */
+
+ /**
+  * @defgroup JvmAPI Output in the JVM's Native Tongue
+  * @brief Lines the Java side can wrap without transcoding
+  * 
+  * Both calls produce exactly the lines skibidi_generate_batch_grammar()
+  * would for the same context, widened to UTF-16LE or framed as
+  * compact-string records while they are stored.
+  * 
+  * Record layout (little-endian, every record padded to 4 bytes):
+  * 
+  *   offset 0: coder (SKIBIDI_CODER_LATIN1 or SKIBIDI_CODER_UTF16)
+  *   offset 1: 0
+  *   offset 2: uint16_t length in chars
+  *   offset 4: length bytes (LATIN1) or length * 2 bytes (UTF16)
+  * 
+  * The coder values match java.lang.String's LATIN1 and UTF16 coders.
+  * @{
+  */
+ 
+ /** @brief One byte per char (java.lang.String.LATIN1) */
+ #define SKIBIDI_CODER_LATIN1  0
+ 
+ /** @brief Two bytes per char, little-endian (java.lang.String.UTF16) */
+ #define SKIBIDI_CODER_UTF16   1
+ 
+ /**
+  * @brief skibidi_generate_batch_grammar() written as newline-separated UTF-16LE
+  * 
+  * @param ctx The factory foreman toilet
+  * @param grammar Dialect (NULL = built-in phrase)
+  * @param buffer Output chars
+  * @param buffer_chars Capacity in chars; each line reserves
+  *                     skibidi_grammar_buffer_size(grammar) chars while it is written
+  * @param count Production quota
+  * @param lengths Optional per-line lengths in chars (newline excluded)
+  * @return Number of lines produced
+  */
+ SKIBIDI_API int skibidi_generate_batch_utf16(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                              uint16_t* buffer, size_t buffer_chars, int count, int* lengths);
+ 
+ /**
+  * @brief skibidi_generate_batch_grammar() written as (coder, length, payload) records
+  * 
+  * @param ctx The factory foreman toilet
+  * @param grammar Dialect (NULL = built-in phrase)
+  * @param buffer Output records (4-byte aligned recommended)
+  * @param buffer_size Capacity in bytes; each record reserves
+  *                    skibidi_grammar_buffer_size(grammar) bytes per byte of coder width
+  * @param count Production quota
+  * @param coder SKIBIDI_CODER_LATIN1 or SKIBIDI_CODER_UTF16
+  * @param lengths Optional per-line lengths in chars
+  * @return Number of records produced (0 for an unknown coder)
+  */
+ SKIBIDI_API int skibidi_generate_batch_records(SkibidiContext* ctx, const SkibidiGrammar* grammar,
+                                                void* buffer, size_t buffer_size, int count, int coder, int* lengths);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup FrameAPI Framed Toilet Output
+  * @brief Lines framed the way the consumer reads them, without a second pass
+  * 
+  * skibidi_generate_batch_framed() writes the lines
+  * skibidi_generate_batch_grammar() would, each one framed as asked
+  * while it is stored. Length prefixes count the line's bytes, framing
+  * excluded. JSON Lines and CSV escape what their format needs (the
+  * built-in phrase never needs any): quotes and backslashes become
+  * \" and \\ in JSON, control and non-ASCII letters \u00XX (the kernels
+  * speak Latin-1), and CSV doubles quotes.
+  * 
+  * @code
+  * size_t used;
+  * int made = skibidi_generate_batch_framed(ctx, NULL, buf, sizeof(buf), 1000,
+  *                                          SKIBIDI_FRAME_JSONL, &used, NULL);
+  * fwrite(buf, 1, used, out);   // {"t":"Skibidi dop dop yes yes!"}\n...
+  * @endcode
+  * @{
+  */
+ 
+ #define SKIBIDI_FRAME_NEWLINE  0   /**< line, '\n' (what skibidi_generate_batch_grammar() writes) */
+ #define SKIBIDI_FRAME_NUL      1   /**< line, '\0' */
+ #define SKIBIDI_FRAME_U8       2   /**< uint8_t length, line */
+ #define SKIBIDI_FRAME_U16      3   /**< uint16_t little-endian length, line */
+ #define SKIBIDI_FRAME_VARINT   4   /**< LEB128 varint length, line */
+ #define SKIBIDI_FRAME_JSONL    5   /**< {"t":"line"} '\n', JSON-escaped */
+ #define SKIBIDI_FRAME_CSV      6   /**< "line" '\n', quotes doubled */
+ 
+ /**
+  * @brief Bytes one line may need in the buffer under a framing
+  * 
+  * @param grammar Dialect (NULL = built-in phrase)
+  * @param framing SKIBIDI_FRAME_*
+  * @return Bytes to budget per line, 0 for an unknown framing (or U8
+  *         for a dialect whose lines can run past 255 bytes)
+  */
+ SKIBIDI_API size_t skibidi_frame_buffer_size(const SkibidiGrammar* grammar, int framing);
+ 
+ /**
+  * @brief skibidi_generate_batch_grammar() with the framing of your choice
+  * 
+  * @param ctx The factory foreman toilet
+  * @param grammar Dialect (NULL = built-in phrase)
+  * @param buffer Output frames
+  * @param buffer_size Capacity in bytes; each line reserves
+  *                    skibidi_frame_buffer_size(grammar, framing) bytes while it is written
+  * @param count Production quota
+  * @param framing SKIBIDI_FRAME_*
+  * @param stream_size Optional, receives the bytes written
+  * @param lengths Optional per-line lengths, framing and escapes excluded
+  * @return Lines produced (0 for an unknown framing)
+  */
+ SKIBIDI_API int skibidi_generate_batch_framed(SkibidiContext* ctx, const SkibidiGrammar* grammar, void* buffer,
+                                               size_t buffer_size, int count, int framing, size_t* stream_size,
+                                               int* lengths);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup HotLineAPI The Toilet's Greatest Hits
+  * @brief Batches where the most common lines are one byte each
+  * 
+  * The prophecy and the nine other plain lines ("Skibidi dop dop no no!",
+  * "Skibidi dop yes yes!", ...) make up roughly half of every batch.
+  * skibidi_generate_batch_hot() recognizes them from the entropy before
+  * anything is written and emits a one-byte reference instead of the
+  * text. Decoded, the stream is exactly the batch skibidi_generate_batch()
+  * would have produced from the same state.
+  * 
+  * Stream layout, one record per line, no newlines:
+  * 
+  *   byte >= SKIBIDI_HOT_REF: greatest hit (byte - SKIBIDI_HOT_REF)
+  *   byte <  SKIBIDI_HOT_REF: literal, that many bytes of line follow
+  * 
+  * A consumer that caches by line resolves each hit once per batch and
+  * never hashes or allocates for it again.
+  * 
+  * @note Toilets without SSE2 or AVX2 speak batches one line at a time
+  *       and only the prophecy is recognized there.
+  * @{
+  */
+ 
+ /** @brief Number of greatest hits (reference values 0 .. SKIBIDI_HOT_LINES - 1) */
+ #define SKIBIDI_HOT_LINES      10
+ 
+ /** @brief Longest greatest hit, rounded up */
+ #define SKIBIDI_HOT_LINE_MAX   40
+ 
+ /** @brief Reference marker: records at or above it are greatest hits */
+ #define SKIBIDI_HOT_REF        0x80u
+ 
+ /**
+  * @brief The greatest hits one batch referenced
+  */
+ typedef struct {
+     uint32_t used;                                          /**< Bit i set: hit i appears in the stream */
+     uint8_t lengths[SKIBIDI_HOT_LINES];                     /**< Length of each used hit, 0 for unused ones */
+     char lines[SKIBIDI_HOT_LINES][SKIBIDI_HOT_LINE_MAX];    /**< Text of each used hit (not NUL-terminated) */
+ } SkibidiHotDictionary;
+ 
+ /**
+  * @brief skibidi_generate_batch() as hit references and literals
+  * 
+  * @code
+  * for (size_t at = 0; at < stream_size; ) {
+  *     uint8_t record = (uint8_t)buffer[at++];
+  *     if (record >= SKIBIDI_HOT_REF) emit(cached[record - SKIBIDI_HOT_REF]);
+  *     else { emit_bytes(buffer + at, record); at += record; }
+  * }
+  * @endcode
+  * 
+  * @param ctx The factory foreman toilet
+  * @param buffer Output records
+  * @param buffer_size Capacity in bytes; each line reserves 1 + SKIBIDI_MIN_BUFFER_SIZE
+  *                    bytes while it is written
+  * @param count Production quota
+  * @param stream_size Receives the number of bytes of records written
+  * @param dictionary Receives the text of every hit the stream references
+  * @return Number of lines produced
+  */
+ SKIBIDI_API int skibidi_generate_batch_hot(SkibidiContext* ctx, char* buffer, size_t buffer_size, int count,
+                                            size_t* stream_size, SkibidiHotDictionary* dictionary);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup ReaderAPI The Toilet's Lending Library
+  * @brief One line at a time at batch speed, without copies
+  * 
+  * A SkibidiReader generates lines a chunk at a time with the same batch
+  * kernels as skibidi_generate_batch() and lends them out as views into
+  * its own buffer. Lines come out in the order the batches would have
+  * produced them.
+  * 
+  * The reader keeps two chunks: a view stays valid until the reader has
+  * refilled twice more, which is never sooner than the call after the
+  * one that lent it. Copy a line if it has to live longer.
+  * 
+  * @code
+  * SkibidiReader* reader;
+  * skibidi_reader_open(ctx, NULL, &reader);
+  * const char* line;
+  * int len = skibidi_reader_next(reader, &line);
+  * skibidi_reader_close(reader);
+  * @endcode
+  * 
+  * A reader is not thread-safe and draws on its context's state: don't
+  * share either of them with other threads while it is open.
+  * @{
+  */
+ 
+ /**
+  * @brief A pull-style line source (opaque, ~200 KiB)
+  */
+ typedef struct SkibidiReader SkibidiReader;
+ 
+ /**
+  * @brief A borrowed line (newline-terminated in the reader's buffer, not NUL-terminated)
+  */
+ typedef struct {
+     const char* line;   /**< First byte of the line */
+     size_t length;      /**< Bytes before the newline */
+ } SkibidiLineView;
+ 
+ /**
+  * @brief Open a reader over a context
+  * 
+  * @param ctx Initialized context supplying the lines (must outlive the reader)
+  * @param grammar Dialect (NULL = built-in phrase, must outlive the reader)
+  * @param[out] out Receives the reader, release with skibidi_reader_close()
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ SKIBIDI_API int skibidi_reader_open(SkibidiContext* ctx, const SkibidiGrammar* grammar, SkibidiReader** out);
+ 
+ /**
+  * @brief Borrow the next line
+  * 
+  * @param reader The reader
+  * @param[out] line Receives a pointer to the line
+  * @return Its length, or SKIBIDI_ERR_NULL_PTR
+  */
+ SKIBIDI_API int skibidi_reader_next(SkibidiReader* reader, const char** line);
+ 
+ /**
+  * @brief Borrow up to n lines
+  * 
+  * Returns fewer than n at the end of a chunk; call again for the rest.
+  * 
+  * @param reader The reader
+  * @param views Receives up to n views
+  * @param n Lines wanted
+  * @return Views written (0 for NULL arguments or n <= 0)
+  */
+ SKIBIDI_API int skibidi_reader_next_n(SkibidiReader* reader, SkibidiLineView* views, int n);
+ 
+ /**
+  * @brief Release a reader and its buffer (NULL is fine)
+  */
+ SKIBIDI_API void skibidi_reader_close(SkibidiReader* reader);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup CorpusAPI The Toilet's Infinite Library
+  * @brief A seeded corpus of any size, rendered a page at a time on demand
+  * 
+  * A SkibidiCorpus is an endless sequence of pages of page_lines lines.
+  * Each page is regenerated from the corpus seed and its index alone,
+  * so nothing is stored but the pages in a small least-recently-used
+  * cache: line 10^15 costs the same as line 0. Pages come from the
+  * canonical stream and read the same on every build.
+  * 
+  * Lines are addressed by index. Byte offsets within a page are known
+  * once it is rendered (skibidi_corpus_locate()); across pages they are
+  * not, since they would depend on every page before.
+  * 
+  * @code
+  * SkibidiCorpus* corpus;
+  * skibidi_corpus_open(42069, NULL, 4096, 16, &corpus);
+  * size_t lines;
+  * size_t bytes = skibidi_corpus_read(corpus, 1000000000, buffer, sizeof(buffer), &lines);
+  * skibidi_corpus_close(corpus);
+  * @endcode
+  * 
+  * A corpus is not thread-safe: give each thread its own (same seed,
+  * same pages).
+  * @{
+  */
+ 
+ /**
+  * @brief A paged virtual corpus (opaque)
+  */
+ typedef struct SkibidiCorpus SkibidiCorpus;
+ 
+ /**
+  * @brief Open a corpus (renders nothing yet)
+  * 
+  * @param seed Corpus seed
+  * @param grammar Dialect (NULL = built-in phrase, must outlive the corpus)
+  * @param page_lines Lines per page (at least 1, page_lines worst-case lines must fit in 4 GiB)
+  * @param cache_pages Pages kept rendered (at least 1)
+  * @param[out] out Receives the corpus, release with skibidi_corpus_close()
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, SKIBIDI_ERR_INVALID_CONFIG or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ SKIBIDI_API int skibidi_corpus_open(uint64_t seed, const SkibidiGrammar* grammar, uint32_t page_lines,
+                                     uint32_t cache_pages, SkibidiCorpus** out);
+ 
+ /**
+  * @brief Borrow a whole page (valid until the next call on the corpus)
+  * 
+  * @param corpus The corpus
+  * @param page Page index
+  * @param[out] bytes Receives page_lines newline-terminated lines
+  * @param[out] size Receives their total size
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
+  */
+ SKIBIDI_API int skibidi_corpus_page(SkibidiCorpus* corpus, uint64_t page, const char** bytes, size_t* size);
+ 
+ /**
+  * @brief Find a line: its page and byte offset within that page
+  * 
+  * @param corpus The corpus
+  * @param line Line index
+  * @param[out] page Receives the page index
+  * @param[out] offset Receives the offset of the line in the page
+  * @return The line's length without the newline, or SKIBIDI_ERR_NULL_PTR
+  */
+ SKIBIDI_API int skibidi_corpus_locate(SkibidiCorpus* corpus, uint64_t line, uint64_t* page, size_t* offset);
+ 
+ /**
+  * @brief Copy whole lines starting at first_line, across pages, while they fit
+  * 
+  * @param corpus The corpus
+  * @param first_line Line index to start at
+  * @param buffer Destination
+  * @param buffer_size Capacity of buffer
+  * @param[out] lines_read Receives the lines copied (may be NULL)
+  * @return Bytes copied
+  */
+ SKIBIDI_API size_t skibidi_corpus_read(SkibidiCorpus* corpus, uint64_t first_line, char* buffer,
+                                        size_t buffer_size, size_t* lines_read);
+ 
+ /**
+  * @brief Release a corpus and its cache (NULL is fine)
+  */
+ SKIBIDI_API void skibidi_corpus_close(SkibidiCorpus* corpus);
  
  /** @} */
  
@@ -304,7 +1313,7 @@
  /**
   * @brief End the toilet's existence (secure state destruction)
   * 
-  * Overwrites all RNG state with zeros using volatile writes so
+  * Overwrites all RNG state with zeros behind a compiler barrier so
   * the compiler can't optimize away the toilet's funeral. The toilet's
   * random consciousness is permanently erased. The dops it generated
   * live on, but the toilet's inner state dies here.
@@ -312,7 +1321,159 @@
   * @param ctx The toilet to put to rest (NULL is accepted, you can
   *            hold a funeral for nothing, the toilet doesn't judge)
   */
- void skibidi_destroy(SkibidiContext* ctx);
+ SKIBIDI_API void skibidi_destroy(SkibidiContext* ctx);
+ 
+ /**
+  * @brief End a whole battalion of toilets (secure state destruction)
+  * 
+  * One wipe over count contiguous contexts with the widest aligned
+  * vector stores the CPU has. Battalions of a MiB or more are wiped
+  * with non-temporal stores so the funeral does not flush the caches
+  * of the toilets still alive.
+  * 
+  * @param ctxs The first toilet in formation (NULL is accepted)
+  * @param count How many toilets to put to rest
+  */
+ SKIBIDI_API void skibidi_destroy_array(SkibidiContext* ctxs, size_t count);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup CheckpointAPI Toilet Time Travel
+  * @brief Save a toilet mid-sentence and bring it back later
+  * 
+  * A snapshot is a fixed-size, versioned, little-endian blob: the RNG
+  * state, the call counter, the identity of the engine that can resume
+  * it, and a checksum over all of it. Write it next to the output the
+  * toilet produced so far; after a preemption, restore it and keep
+  * generating exactly where the stream left off.
+  * 
+  * @code
+  * uint8_t checkpoint[SKIBIDI_SNAPSHOT_SIZE];
+  * skibidi_snapshot(&ctx, checkpoint, sizeof(checkpoint));
+  * ... later, on any machine ...
+  * if (skibidi_restore(&ctx, checkpoint, sizeof(checkpoint)) == SKIBIDI_OK) {
+  *     // the next line is the one that would have followed the checkpoint
+  * }
+  * @endcode
+  * @{
+  */
+ 
+ /** @brief Bytes in a snapshot */
+ #define SKIBIDI_SNAPSHOT_SIZE     136
+ 
+ /** @brief Snapshot format written by this library */
+ #define SKIBIDI_SNAPSHOT_VERSION  1
+ 
+ /**
+  * @brief Freeze the toilet into a snapshot
+  * 
+  * @param ctx The toilet to freeze (not modified)
+  * @param buffer Where the snapshot goes
+  * @param buffer_size At least SKIBIDI_SNAPSHOT_SIZE bytes
+  * @return SKIBIDI_SNAPSHOT_SIZE, SKIBIDI_ERR_NULL_PTR or SKIBIDI_ERR_BUFFER_TOO_SMALL
+  */
+ SKIBIDI_API int skibidi_snapshot(const SkibidiContext* ctx, void* buffer, size_t buffer_size);
+ 
+ /**
+  * @brief Thaw a snapshot back into a toilet
+  * 
+  * The context is only written when the snapshot checks out: magic,
+  * version, engine identity, checksum and state all valid.
+  * 
+  * @param ctx The toilet to become the snapshotted one
+  * @param buffer A snapshot from skibidi_snapshot()
+  * @param buffer_size Bytes available at buffer
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, SKIBIDI_ERR_BUFFER_TOO_SMALL or
+  *         SKIBIDI_ERR_CORRUPT_SNAPSHOT
+  */
+ SKIBIDI_API int skibidi_restore(SkibidiContext* ctx, const void* buffer, size_t buffer_size);
+ 
+ /**
+  * @brief Bud off an independent child toilet in O(1)
+  * 
+  * The child is seeded from one flush of each of the parent's four
+  * lanes, so the parent moves on by one step and forking twice gives
+  * two different children. Deterministic: the same parent state always
+  * buds the same child. The child's call counter starts at zero.
+  * 
+  * @param ctx The parent (advanced by one flush per lane)
+  * @param child Receives the new stream (must not be the parent)
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR or SKIBIDI_ERR_INVALID_CONFIG
+  */
+ SKIBIDI_API int skibidi_fork(SkibidiContext* ctx, SkibidiContext* child);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup ProbeAPI The Toilet's Stopwatch
+  * @brief Sampled latency histograms from inside the library
+  * 
+  * Off by default. skibidi_probe_configure(N) makes every thread time
+  * one call in N of skibidi_generate(), skibidi_generate_variant(),
+  * skibidi_generate_batch() and skibidi_generate_batch64() with RDTSCP,
+  * into its own log-bucketed histograms keyed by entry point and
+  * batch-size class. Threads never share a histogram: each snapshots,
+  * merges and resets its own, and a collector merges the snapshots.
+  * 
+  * With probes off an entry point pays one relaxed load from a cache
+  * line it reads anyway, so they can stay compiled in under real load.
+  * 
+  * Ticks are TSC ticks on x86 (nanoseconds elsewhere). Bucket b covers
+  * skibidi_probe_bucket_floor(b) up to the next bucket's floor: exact
+  * below 4 ticks, then 4 buckets per power of two (~19% wide); the last
+  * bucket also takes everything above it.
+  * @{
+  */
+ 
+ #define SKIBIDI_PROBE_GENERATE       0   /**< skibidi_generate() */
+ #define SKIBIDI_PROBE_VARIANT        1   /**< skibidi_generate_variant() */
+ #define SKIBIDI_PROBE_BATCH          2   /**< skibidi_generate_batch() */
+ #define SKIBIDI_PROBE_BATCH64        3   /**< skibidi_generate_batch64() */
+ #define SKIBIDI_PROBE_ENTRY_POINTS   4
+ 
+ /** @brief Size classes by requested lines: 1, 2-64, 65-4096, more */
+ #define SKIBIDI_PROBE_SIZE_CLASSES   4
+ 
+ /** @brief Buckets per histogram (the last one reaches past 2^33 ticks) */
+ #define SKIBIDI_PROBE_BUCKETS        128
+ 
+ /**
+  * @brief Latency histograms for every entry point and size class
+  */
+ typedef struct {
+     uint64_t counts[SKIBIDI_PROBE_ENTRY_POINTS][SKIBIDI_PROBE_SIZE_CLASSES][SKIBIDI_PROBE_BUCKETS];
+     uint64_t total_ticks[SKIBIDI_PROBE_ENTRY_POINTS][SKIBIDI_PROBE_SIZE_CLASSES];  /**< Sum, for the mean */
+     uint64_t max_ticks[SKIBIDI_PROBE_ENTRY_POINTS][SKIBIDI_PROBE_SIZE_CLASSES];    /**< Worst sample seen */
+ } SkibidiProbeHistogram;
+ 
+ /**
+  * @brief Turn sampling on (1 call in sample_every per thread) or off (0)
+  * @return SKIBIDI_OK
+  */
+ SKIBIDI_API int skibidi_probe_configure(uint32_t sample_every);
+ 
+ /**
+  * @brief Copy the calling thread's histograms
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
+  */
+ SKIBIDI_API int skibidi_probe_snapshot(SkibidiProbeHistogram* out);
+ 
+ /**
+  * @brief Add from's counts into into's (max is the max of both)
+  * @return SKIBIDI_OK or SKIBIDI_ERR_NULL_PTR
+  */
+ SKIBIDI_API int skibidi_probe_merge(SkibidiProbeHistogram* into, const SkibidiProbeHistogram* from);
+ 
+ /**
+  * @brief Clear the calling thread's histograms
+  */
+ SKIBIDI_API void skibidi_probe_reset(void);
+ 
+ /**
+  * @brief Lower bound of a bucket in ticks (0 for an out-of-range bucket)
+  */
+ SKIBIDI_API uint64_t skibidi_probe_bucket_floor(int bucket);
  
  /** @} */
  
@@ -334,7 +1495,7 @@
   * 
   * @note Release with skibidi_free_context() when the toilet's work is done
   */
- SkibidiContext* skibidi_alloc_context(void);
+ SKIBIDI_API SkibidiContext* skibidi_alloc_context(void);
  
  /**
   * @brief Summon a battalion of aligned toilets from the heap
@@ -348,9 +1509,9 @@
   * @return Pointer to the first toilet in formation, or NULL if the
   *         heap cannot accommodate this many toilets (try fewer toilets)
   * 
-  * @note Release with skibidi_free_context() when the battalion is dismissed
+  * @note Release with skibidi_free_context_array() when the battalion is dismissed
   */
- SkibidiContext* skibidi_alloc_context_array(size_t count);
+ SKIBIDI_API SkibidiContext* skibidi_alloc_context_array(size_t count);
  
  /**
   * @brief Return a toilet to the heap (with full funeral honors)
@@ -362,7 +1523,89 @@
   * 
   * @param ctx The toilet to decommission (NULL is fine, freeing nothing is free)
   */
- void skibidi_free_context(SkibidiContext* ctx);
+ SKIBIDI_API void skibidi_free_context(SkibidiContext* ctx);
+ 
+ /**
+  * @brief Return a whole battalion to the heap (with full funeral honors)
+  * 
+  * skibidi_destroy_array() over the battalion, then one free for the
+  * block skibidi_alloc_context_array() handed out.
+  * 
+  * @param ctxs The battalion to decommission (NULL is fine)
+  * @param count The count the battalion was summoned with
+  */
+ SKIBIDI_API void skibidi_free_context_array(SkibidiContext* ctxs, size_t count);
+ 
+ /** @} */
+ 
+ /**
+  * @defgroup PoolAPI The Toilet Cloakroom
+  * @brief Request-scoped toilets without the heap, the seeding or the funeral
+  * 
+  * A SkibidiContextPool lends out toilets from one pre-allocated,
+  * cache-aligned battalion through a lock-free free list. Acquiring and
+  * releasing cost a compare-and-swap each, plus an O(1) rebirth on
+  * acquire (skibidi_fork() style), instead of an aligned_alloc,
+  * skibidi_init() and skibidi_destroy() per request. Every acquire
+  * hands out a stream no previous borrower of that toilet has drawn
+  * from.
+  * 
+  * @code
+  * SkibidiContextPool* pool;
+  * skibidi_pool_create(64, 42069, &pool);
+  * SkibidiContext* ctx = skibidi_pool_acquire(pool);   // in a handler
+  * skibidi_generate(ctx, buf, sizeof(buf));
+  * skibidi_pool_release(pool, ctx);
+  * skibidi_pool_destroy(pool);                          // at shutdown
+  * @endcode
+  * 
+  * Acquire and release are safe from any number of threads; a borrowed
+  * toilet belongs to its borrower alone until it is released, and must
+  * be released exactly once.
+  * @{
+  */
+ 
+ /**
+  * @brief A cloakroom of lendable toilets (opaque)
+  */
+ typedef struct SkibidiContextPool SkibidiContextPool;
+ 
+ /**
+  * @brief Open a pool of capacity seeded toilets
+  * 
+  * @param capacity Toilets that can be lent out at once (1 to 2^32 - 2)
+  * @param seed Every toilet is budded off one toilet born from this seed
+  * @param[out] out Receives the pool, release with skibidi_pool_destroy()
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, SKIBIDI_ERR_INVALID_CONFIG
+  *         for a capacity out of range, or SKIBIDI_ERR_OUT_OF_MEMORY
+  */
+ SKIBIDI_API int skibidi_pool_create(size_t capacity, uint64_t seed, SkibidiContextPool** out);
+ 
+ /**
+  * @brief Borrow a freshly reseeded toilet
+  * 
+  * @param pool The pool
+  * @return A ready toilet, or NULL if pool is NULL or all toilets are lent out
+  *         (the pool never grows, size it for peak concurrency)
+  */
+ SKIBIDI_API SkibidiContext* skibidi_pool_acquire(SkibidiContextPool* pool);
+ 
+ /**
+  * @brief Hand a borrowed toilet back
+  * 
+  * @param pool The pool it was borrowed from
+  * @param ctx The toilet skibidi_pool_acquire() returned
+  * @return SKIBIDI_OK, SKIBIDI_ERR_NULL_PTR, or SKIBIDI_ERR_INVALID_CONFIG
+  *         if ctx does not belong to pool
+  */
+ SKIBIDI_API int skibidi_pool_release(SkibidiContextPool* pool, SkibidiContext* ctx);
+ 
+ /**
+  * @brief Wipe every toilet and free the pool (NULL is fine)
+  * 
+  * Toilets still lent out become invalid.
+  */
+ SKIBIDI_API void skibidi_pool_destroy(SkibidiContextPool* pool);
  
  /** @} */
  
@@ -376,28 +1619,28 @@
   * 
   * @return Version string, e.g. "1.7.1-skibidi-ultra"
   */
- const char* skibidi_version(void);
+ SKIBIDI_API const char* skibidi_version(void);
  
  /**
   * @brief Does this CPU's toilet support AVX2? (256-bit dop pipes)
   * 
   * @return 1 if the toilet has 256-bit flushing capability, 0 if it's stuck with scalar
   */
- int skibidi_has_avx2(void);
+ SKIBIDI_API int skibidi_has_avx2(void);
  
  /**
   * @brief Does this CPU's toilet support AVX-512? (512-bit megapipes)
   * 
   * @return 1 if the toilet has transcended to 512-bit godhood, 0 if mortal
   */
- int skibidi_has_avx512(void);
+ SKIBIDI_API int skibidi_has_avx512(void);
  
  /**
   * @brief Read the toilet's complete power level scouter
   * 
   * @return Bitmask of SKIBIDI_CAP_* flags (the toilet's full aura readout)
   */
- uint32_t skibidi_get_capabilities(void);
+ SKIBIDI_API uint32_t skibidi_get_capabilities(void);
  
  /**
   * @brief What SIMD toilet dimension is currently active?
@@ -405,9 +1648,10 @@
   * Takes into account both hardware capability and user configuration
   * to report which toilet dimension is actually being used right now.
   * 
-  * @return "AVX-512" (godmode), "AVX2" (sigma mode), or "Scalar" (Ohio mode)
+  * @return "AVX-512" (godmode), "AVX2" (sigma mode), "SSE2" (long strides,
+  *         batches still run a real factory) or "Scalar" (Ohio mode)
   */
- const char* skibidi_get_active_simd(void);
+ SKIBIDI_API const char* skibidi_get_active_simd(void);
  
  /**
   * @brief Is the toilet currently operating in AVX-512 ultra instinct?
@@ -418,7 +1662,7 @@
   * 
   * @return 1 if the toilet is in final form, 0 if it's holding back
   */
- int skibidi_is_avx512_enabled(void);
+ SKIBIDI_API int skibidi_is_avx512_enabled(void);
  
  /**
   * @brief How many bytes does the toilet's brain occupy?
@@ -428,7 +1672,7 @@
   * 
   * @return Size of SkibidiRngState in bytes (the toilet's cranial volume)
   */
- size_t skibidi_get_rng_state_size(void);
+ SKIBIDI_API size_t skibidi_get_rng_state_size(void);
  
  /**
   * @brief How many bytes does the entire toilet occupy?
@@ -437,7 +1681,7 @@
   * 
   * @return Size of SkibidiContext in bytes (currently 192, the toilet's BMI)
   */
- size_t skibidi_get_context_size(void);
+ SKIBIDI_API size_t skibidi_get_context_size(void);
  
  /**
   * @brief What alignment does the toilet require for optimal energy flow?
@@ -447,7 +1691,7 @@
   * 
   * @return Alignment in bytes (64, because the toilet demands cache line feng shui)
   */
- size_t skibidi_get_context_alignment(void);
+ SKIBIDI_API size_t skibidi_get_context_alignment(void);
  
  /** @} */
  
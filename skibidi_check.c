@@ -0,0 +1,225 @@
+/**
+ * @file skibidi_check.c
+ * @brief Skibidi Toilet Dialect Audit - Built-in Equivalence Check
+ *
+ * The built-in phrase compiled as a grammar must say exactly what the
+ * built-in entry points say: same lines, same order, every kernel.
+ * This driver speaks both side by side from twin contexts and compares
+ * them line by line, for single calls, variant calls, batches (a whole
+ * number of quads and a count with stragglers), UTF-16 batches and
+ * framed batches, under the default stream, canonical_stream and
+ * constant_time, for Lehmer64 and ChaCha toilets.
+ *
+ * Output is one "<stream> <engine> <workload> <verdict>" row per case,
+ * then "all dialects agree" or the number of failing cases. Exits 1 on
+ * any difference.
+ *
+ * Usage: skibidi_check [seed]   (default 12345)
+ *
+ * @note Not part of the library. Built and run only by build.sh check.
+ */
+ 
+ #include "skibidi_avx.h"
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ 
+ /** @brief Single and variant calls per case */
+ #define CHECK_SINGLE_CALLS    4096
+ 
+ /** @brief Batch sizes: whole quads, then stragglers on both ends of the quads */
+ #define CHECK_BATCH_LINES     4096
+ #define CHECK_ODD_LINES       1023
+ 
+ /** @brief Batches per case (later ones start mid-stream, off the quad boundary) */
+ #define CHECK_BATCH_ROUNDS    3
+ 
+ /**
+  * @brief Lines of one batch, as (offset, length) pairs into a flat byte or char array
+  */
+ typedef struct {
+     size_t offset[CHECK_BATCH_LINES];
+     int length[CHECK_BATCH_LINES];
+     int count;
+ } CheckTally;
+ 
+ /**
+  * @brief Seed the twins: both Lehmer64 from the seed, or both ChaCha8 under a key made from it
+  */
+ static int check_twins(SkibidiContext* a, SkibidiContext* b, uint64_t seed, int chacha) {
+     if (!chacha) {
+         return skibidi_init(a, seed) | skibidi_init(b, seed);
+     }
+     uint8_t key[SKIBIDI_CHACHA_KEY_SIZE];
+     for (int i = 0; i < SKIBIDI_CHACHA_KEY_SIZE; i++) key[i] = (uint8_t)(seed >> (8 * (i & 7))) ^ (uint8_t)i;
+     return skibidi_init_chacha(a, key, seed, 8) | skibidi_init_chacha(b, key, seed, 8);
+ }
+ 
+ /**
+  * @brief Turn newline-separated lines into a tally (lengths exclude the newline)
+  */
+ static void check_tally_lines(CheckTally* tally, const int* lengths, int count) {
+     size_t at = 0;
+     for (int i = 0; i < count; i++) {
+         tally->offset[i] = at;
+         tally->length[i] = lengths[i];
+         at += (size_t)lengths[i] + 1;
+     }
+     tally->count = count;
+ }
+ 
+ /**
+  * @brief Count lines that differ between two tallies of the same element size
+  */
+ static int check_compare(const CheckTally* a, const void* a_data, const CheckTally* b, const void* b_data,
+                          size_t element) {
+     if (a->count != b->count) return a->count > b->count ? a->count : b->count;
+     int differ = 0;
+     for (int i = 0; i < a->count; i++) {
+         differ += a->length[i] != b->length[i] ||
+                   memcmp((const char*)a_data + a->offset[i] * element,
+                          (const char*)b_data + b->offset[i] * element, (size_t)a->length[i] * element) != 0;
+     }
+     return differ;
+ }
+ 
+ /**
+  * @brief Report one case and return 1 if it failed
+  */
+ static int check_report(const char* stream, const char* engine, const char* workload, int differ, int lines) {
+     if (differ) {
+         printf("%-13s %-7s %-12s %d of %d lines differ\n", stream, engine, workload, differ, lines);
+     } else {
+         printf("%-13s %-7s %-12s ok (%d lines)\n", stream, engine, workload, lines);
+     }
+     return differ != 0;
+ }
+ 
+ int main(int argc, char** argv) {
+     const uint64_t seed = argc > 1 ? strtoull(argv[1], NULL, 0) : 12345;
+ 
+     SkibidiGrammarSpec spec;
+     skibidi_grammar_builtin_spec(&spec);
+     SkibidiGrammar* grammar = NULL;
+     if (skibidi_grammar_compile(&spec, &grammar) != SKIBIDI_OK) {
+         fprintf(stderr, "the built-in dialect did not compile\n");
+         return 1;
+     }
+ 
+     /* Room for every line at either reserve, so capacity never splits the two differently */
+     size_t reserve = skibidi_grammar_buffer_size(grammar);
+     if (reserve < skibidi_frame_buffer_size(grammar, SKIBIDI_FRAME_NEWLINE)) {
+         reserve = skibidi_frame_buffer_size(grammar, SKIBIDI_FRAME_NEWLINE);
+     }
+     const size_t warehouse_size = CHECK_BATCH_LINES * reserve;
+     char* built_in = malloc(warehouse_size);
+     char* dialect = malloc(warehouse_size);
+     uint16_t* built_in_chars = malloc(warehouse_size * sizeof(uint16_t));
+     uint16_t* dialect_chars = malloc(warehouse_size * sizeof(uint16_t));
+     int* built_in_lengths = malloc(CHECK_BATCH_LINES * sizeof(int));
+     int* dialect_lengths = malloc(CHECK_BATCH_LINES * sizeof(int));
+     CheckTally* built_in_tally = malloc(sizeof(CheckTally));
+     CheckTally* dialect_tally = malloc(sizeof(CheckTally));
+     SkibidiContext* a = skibidi_alloc_context();
+     SkibidiContext* b = skibidi_alloc_context();
+     if (!built_in || !dialect || !built_in_chars || !dialect_chars || !built_in_lengths || !dialect_lengths ||
+         !built_in_tally || !dialect_tally || !a || !b) {
+         fprintf(stderr, "the heap's bathroom is full\n");
+         return 1;
+     }
+ 
+     static const char* const streams[3] = { "default", "canonical", "constant_time" };
+     static const char* const engines[2] = { "lehmer", "chacha" };
+     static const int batch_sizes[2] = { CHECK_BATCH_LINES, CHECK_ODD_LINES };
+     int failures = 0;
+ 
+     for (int stream = 0; stream < 3; stream++) {
+         SkibidiConfig config;
+         skibidi_get_config(&config);
+         config.canonical_stream = stream >= 1;
+         config.constant_time = stream == 2;
+         if (skibidi_configure(&config) != SKIBIDI_OK) {
+             fprintf(stderr, "the toilet rejected the %s stream\n", streams[stream]);
+             return 1;
+         }
+ 
+         for (int engine = 0; engine < 2; engine++) {
+             /* Single and variant calls, each from fresh twins */
+             for (int variant = 0; variant < 2; variant++) {
+                 if (check_twins(a, b, seed, engine) != SKIBIDI_OK) return 1;
+                 int differ = 0;
+                 for (int i = 0; i < CHECK_SINGLE_CALLS; i++) {
+                     char x[SKIBIDI_MIN_BUFFER_SIZE];
+                     char* y = dialect;
+                     const int lx = variant ? skibidi_generate_variant(a, x, sizeof(x)) : skibidi_generate(a, x, sizeof(x));
+                     const int ly = variant ? skibidi_generate_grammar_variant(b, grammar, y, reserve)
+                                            : skibidi_generate_grammar(b, grammar, y, reserve);
+                     differ += lx != ly || memcmp(x, y, (size_t)(lx > 0 ? lx : 0)) != 0;
+                 }
+                 failures += check_report(streams[stream], engines[engine], variant ? "variant" : "single",
+                                          differ, CHECK_SINGLE_CALLS);
+             }
+ 
+             /* Byte batches, UTF-16 batches and framed batches, each size from fresh twins */
+             for (int kind = 0; kind < 3; kind++) {
+                 static const char* const names[3][2] = {
+                     { "batch", "batch-odd" }, { "utf16", "utf16-odd" }, { "framed", "framed-odd" },
+                 };
+                 for (int size = 0; size < 2; size++) {
+                     if (check_twins(a, b, seed, engine) != SKIBIDI_OK) return 1;
+                     const int count = batch_sizes[size];
+                     int differ = 0;
+                     int lines = 0;
+                     for (int round = 0; round < CHECK_BATCH_ROUNDS; round++) {
+                         int made_a, made_b;
+                         if (kind == 0) {
+                             made_a = skibidi_generate_batch(a, built_in, warehouse_size, count, built_in_lengths);
+                             made_b = skibidi_generate_batch_grammar(b, grammar, dialect, warehouse_size, count,
+                                                                     dialect_lengths);
+                         } else if (kind == 1) {
+                             made_a = skibidi_generate_batch_utf16(a, NULL, built_in_chars, warehouse_size, count,
+                                                                   built_in_lengths);
+                             made_b = skibidi_generate_batch_utf16(b, grammar, dialect_chars, warehouse_size, count,
+                                                                   dialect_lengths);
+                         } else {
+                             made_a = skibidi_generate_batch_framed(a, NULL, built_in, warehouse_size, count,
+                                                                    SKIBIDI_FRAME_NEWLINE, NULL, built_in_lengths);
+                             made_b = skibidi_generate_batch_framed(b, grammar, dialect, warehouse_size, count,
+                                                                    SKIBIDI_FRAME_NEWLINE, NULL, dialect_lengths);
+                         }
+                         if (made_a < 0 || made_b < 0) {
+                             fprintf(stderr, "the %s batch failed (%d, %d)\n", names[kind][size], made_a, made_b);
+                             return 1;
+                         }
+                         check_tally_lines(built_in_tally, built_in_lengths, made_a);
+                         check_tally_lines(dialect_tally, dialect_lengths, made_b);
+                         differ += kind == 1
+                             ? check_compare(built_in_tally, built_in_chars, dialect_tally, dialect_chars, sizeof(uint16_t))
+                             : check_compare(built_in_tally, built_in, dialect_tally, dialect, 1);
+                         lines += made_a;
+                     }
+                     failures += check_report(streams[stream], engines[engine], names[kind][size], differ, lines);
+                 }
+             }
+         }
+     }
+ 
+     if (failures) {
+         printf("%d cases differ\n", failures);
+     } else {
+         printf("all dialects agree\n");
+     }
+ 
+     skibidi_free_context(b);
+     skibidi_free_context(a);
+     free(dialect_tally);
+     free(built_in_tally);
+     free(dialect_lengths);
+     free(built_in_lengths);
+     free(dialect_chars);
+     free(built_in_chars);
+     free(dialect);
+     free(built_in);
+     skibidi_grammar_free(grammar);
+     return failures != 0;
+ }
@@ -0,0 +1,206 @@
+/**
+ * @file skibidi_dudect.c
+ * @brief Skibidi Toilet Poker Night - Constant-Time Timing Harness
+ * 
+ * A dudect-style check of the constant-time kernels: every measurement
+ * times one call on a context seeded either with a fixed seed or with a
+ * fresh random one, the two classes interleaved at random, and Welch's
+ * t-test asks whether the two timing distributions differ. The test is
+ * repeated on the measurements below a few percentiles of a warm-up
+ * run (dudect's cropping), since a leak often hides in the fast tail
+ * while interrupts inflate the slow one.
+ * 
+ * Workloads are a single line (skibidi_generate()) and a 16-line batch
+ * (skibidi_generate_batch()) with constant_time on. |t| below 4.5 is
+ * what a poker face looks like; above 10 the toilet is leaking.
+ * 
+ * Output is one "<workload> <crop> |t|" row per workload and crop,
+ * then a "verdict" row with the largest |t| seen. Exits 1 above 10.
+ * 
+ * Usage: skibidi_dudect [measurements] [normal]
+ *   measurements  per workload (default 1000000)
+ *   normal        time the ordinary kernels instead, as a control that
+ *                 the harness can see a leak (expect a large |t|)
+ * 
+ * @note Not part of the library. Built and run only by build.sh ct.
+ */
+ 
+ #include "skibidi_avx.h"
+ #include <math.h>
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <time.h>
+ #include <x86intrin.h>
+ 
+ /** @brief Contexts prepared per chunk (seeding stays outside the timed region) */
+ #define DUDECT_CHUNK          4096
+ 
+ /** @brief Lines per call in the batch workload */
+ #define DUDECT_BATCH_LINES    16
+ 
+ /** @brief Crops: everything, then below these percentiles of the warm-up chunk */
+ #define DUDECT_CROPS          4
+ 
+ /** @brief |t| above which the toilet is declared leaky (dudect's threshold) */
+ #define DUDECT_LEAK_T         10.0
+ 
+ /** @brief The fixed class's seed */
+ #define DUDECT_FIXED_SEED     0x5EED5B1B1D1ULL
+ 
+ /**
+  * @brief Welford accumulators for one crop: count, mean and M2 per class
+  */
+ typedef struct {
+     double n[2];
+     double mean[2];
+     double m2[2];
+ } DudectCensus;
+ 
+ /**
+  * @brief SplitMix64 for class coins and random seeds (not the library's RNG on purpose)
+  */
+ static uint64_t dudect_coin(uint64_t* state) {
+     uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+     z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+     z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+     return z ^ (z >> 31);
+ }
+ 
+ /**
+  * @brief Serialized cycle counter (the toilet's stopwatch, fenced)
+  */
+ static inline uint64_t dudect_cycles(void) {
+     _mm_lfence();
+     const uint64_t t = __rdtsc();
+     _mm_lfence();
+     return t;
+ }
+ 
+ /**
+  * @brief Fold one measurement into its class's running mean and M2
+  */
+ static void dudect_push(DudectCensus* census, int cls, double x) {
+     census->n[cls] += 1;
+     const double delta = x - census->mean[cls];
+     census->mean[cls] += delta / census->n[cls];
+     census->m2[cls] += delta * (x - census->mean[cls]);
+ }
+ 
+ /**
+  * @brief Welch's t between the two classes (0 until both have samples)
+  */
+ static double dudect_t(const DudectCensus* census) {
+     if (census->n[0] < 2 || census->n[1] < 2) return 0;
+     const double v0 = census->m2[0] / (census->n[0] - 1);
+     const double v1 = census->m2[1] / (census->n[1] - 1);
+     const double se = sqrt(v0 / census->n[0] + v1 / census->n[1]);
+     return se > 0 ? (census->mean[0] - census->mean[1]) / se : 0;
+ }
+ 
+ /** @brief qsort order for cycle counts */
+ static int dudect_by_cycles(const void* a, const void* b) {
+     const uint64_t x = *(const uint64_t*)a;
+     const uint64_t y = *(const uint64_t*)b;
+     return (x > y) - (x < y);
+ }
+ 
+ /**
+  * @brief Time one chunk: seed every context by its class, then one call each
+  */
+ static void dudect_chunk(SkibidiContext* ctxs, const uint8_t* classes, uint64_t* cycles, int batch,
+                          char* warehouse, size_t warehouse_size, int* lengths, uint64_t* checksum,
+                          uint64_t* coin) {
+     for (int i = 0; i < DUDECT_CHUNK; i++) {
+         skibidi_init(&ctxs[i], classes[i] ? dudect_coin(coin) : DUDECT_FIXED_SEED);
+     }
+     for (int i = 0; i < DUDECT_CHUNK; i++) {
+         const uint64_t t = dudect_cycles();
+         const int made = batch
+             ? skibidi_generate_batch(&ctxs[i], warehouse, warehouse_size, DUDECT_BATCH_LINES, lengths)
+             : skibidi_generate(&ctxs[i], warehouse, warehouse_size);
+         cycles[i] = dudect_cycles() - t;
+         *checksum += (uint64_t)made;
+     }
+ }
+ 
+ int main(int argc, char** argv) {
+     const long measurements = argc > 1 ? atol(argv[1]) : 1000000;
+     const int control = argc > 2 && strcmp(argv[2], "normal") == 0;
+     if (measurements < DUDECT_CHUNK || (argc > 2 && !control)) {
+         fprintf(stderr, "usage: %s [measurements >= %d] [normal]\n", argv[0], DUDECT_CHUNK);
+         return 1;
+     }
+ 
+     SkibidiConfig config;
+     skibidi_get_config(&config);
+     config.constant_time = !control;
+     if (skibidi_configure(&config) != SKIBIDI_OK) {
+         fprintf(stderr, "the toilet refused to keep a poker face\n");
+         return 1;
+     }
+ 
+     SkibidiContext* ctxs = skibidi_alloc_context_array(DUDECT_CHUNK);
+     const size_t warehouse_size = DUDECT_BATCH_LINES * SKIBIDI_MIN_BUFFER_SIZE;
+     char* warehouse = malloc(warehouse_size);
+     int* lengths = malloc(DUDECT_BATCH_LINES * sizeof(int));
+     uint8_t* classes = malloc(DUDECT_CHUNK);
+     uint64_t* cycles = malloc(DUDECT_CHUNK * sizeof(uint64_t));
+     uint64_t* sorted = malloc(DUDECT_CHUNK * sizeof(uint64_t));
+     if (!ctxs || !warehouse || !lengths || !classes || !cycles || !sorted) {
+         fprintf(stderr, "the heap's bathroom is full\n");
+         return 1;
+     }
+ 
+     static const char* const workloads[2] = { "line", "batch" };
+     static const char* const crop_names[DUDECT_CROPS] = { "all", "p99", "p90", "p50" };
+     static const double crop_levels[DUDECT_CROPS] = { 1.0, 0.99, 0.90, 0.50 };
+     uint64_t coin = (uint64_t)time(NULL) ^ (uint64_t)__rdtsc();
+     uint64_t checksum = 0;
+     double worst = 0;
+ 
+     printf("kernels  %s\n", control ? "normal (control)" : "constant_time");
+     for (int batch = 0; batch < 2; batch++) {
+         DudectCensus census[DUDECT_CROPS];
+         memset(census, 0, sizeof(census));
+         uint64_t crop[DUDECT_CROPS];
+ 
+         /* Warm-up chunk: caches, branch predictors and the crop thresholds */
+         for (int i = 0; i < DUDECT_CHUNK; i++) classes[i] = dudect_coin(&coin) & 1;
+         dudect_chunk(ctxs, classes, cycles, batch, warehouse, warehouse_size, lengths, &checksum, &coin);
+         memcpy(sorted, cycles, DUDECT_CHUNK * sizeof(uint64_t));
+         qsort(sorted, DUDECT_CHUNK, sizeof(uint64_t), dudect_by_cycles);
+         for (int c = 0; c < DUDECT_CROPS; c++) {
+             crop[c] = c ? sorted[(size_t)(crop_levels[c] * (DUDECT_CHUNK - 1))] : UINT64_MAX;
+         }
+ 
+         for (long done = 0; done < measurements; done += DUDECT_CHUNK) {
+             for (int i = 0; i < DUDECT_CHUNK; i++) classes[i] = dudect_coin(&coin) & 1;
+             dudect_chunk(ctxs, classes, cycles, batch, warehouse, warehouse_size, lengths, &checksum, &coin);
+             for (int i = 0; i < DUDECT_CHUNK; i++) {
+                 for (int c = 0; c < DUDECT_CROPS; c++) {
+                     if (cycles[i] <= crop[c]) dudect_push(&census[c], classes[i], (double)cycles[i]);
+                 }
+             }
+         }
+ 
+         for (int c = 0; c < DUDECT_CROPS; c++) {
+             const double t = fabs(dudect_t(&census[c]));
+             if (t > worst) worst = t;
+             printf("%-8s %-4s |t| %7.2f  (fixed %.1f / random %.1f cycles)\n", workloads[batch],
+                    crop_names[c], t, census[c].mean[0], census[c].mean[1]);
+         }
+     }
+     printf("%-8s max |t| %7.2f  %s\n", "verdict", worst,
+            worst > DUDECT_LEAK_T ? "LEAKING" : worst > 4.5 ? "suspicious" : "poker face");
+     fprintf(stderr, "checksum %llu\n", (unsigned long long)checksum);
+ 
+     free(sorted);
+     free(cycles);
+     free(classes);
+     free(lengths);
+     free(warehouse);
+     skibidi_free_context_array(ctxs, DUDECT_CHUNK);
+     return worst > DUDECT_LEAK_T;
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,51 @@
+/**
+ * @file skibidi_inline.h
+ * @brief Skibidi Toilet Summoning Engine - Header-Only Incarnation
+ * 
+ * Include this instead of skibidi_avx.h and the entire engine compiles
+ * into your translation unit with static inline linkage. No PLT hop, no
+ * shared library, and the compiler may absorb toilet_speak_ultra() into
+ * your own loops (see skibidi_speak_raw()). skibidi_avx.c must sit next
+ * to this header.
+ * 
+ * Each translation unit that includes this header gets its own private
+ * toilet: its own CPU detection and its own skibidi_configure() state.
+ * Contexts themselves are plain data and may be shared between them.
+ * 
+ * @code
+ * #include "skibidi_inline.h"
+ * 
+ * SkibidiContext ctx;
+ * skibidi_init(&ctx, 42069);
+ * SkibidiRngState rng = ctx.rng;
+ * for (size_t i = 0; i < n; i++) {
+ *     out += skibidi_speak_raw(&rng, out);
+ *     *out++ = '\n';
+ * }
+ * ctx.rng = rng;
+ * @endcode
+ * 
+ * C++ callers get the same cross-boundary inlining by linking the
+ * static archive build.sh produces (libskibidi_avx.a, LTO bitcode
+ * included) with -flto.
+ * 
+ * @note Compile with the same -march you would give the library, the
+ *       toilet's SIMD paths are chosen at compile time.
+ */
+
+ #ifndef SKIBIDI_INLINE_H
+ #define SKIBIDI_INLINE_H
+ 
+ #ifdef __cplusplus
+ #error "skibidi_inline.h is C only; C++ callers link libskibidi_avx.a with -flto instead"
+ #endif
+ 
+ #ifdef SKIBIDI_AVX_H
+ #error "Include skibidi_inline.h instead of skibidi_avx.h, not after it"
+ #endif
+ 
+ #define SKIBIDI_API static inline
+ 
+ #include "skibidi_avx.c"
+ 
+ #endif /* SKIBIDI_INLINE_H */
@@ -0,0 +1,143 @@
+/**
+ * @file skibidi_train.c
+ * @brief Skibidi Toilet Training Regimen - PGO Workload Driver
+ * 
+ * A representative day in the life of a production toilet: single
+ * calls into 64-byte scrolls, variant calls, 1024-line batches into
+ * ~72 KiB warehouses, a custom dialect and the JVM-facing UTF-16 batch.
+ * build.sh pgo runs it against the instrumented library to collect the
+ * branch profile, then against the plain and the optimized library to
+ * report the gain.
+ * 
+ * Output is one "<workload> <ns> ns/line" row per workload and a final
+ * "total" row (the time-weighted sum, what build.sh compares).
+ * 
+ * Usage: skibidi_train [rounds]   (default 2000, one round = ~20K lines)
+ * 
+ * @note Not part of the library. Built and run only by build.sh pgo.
+ */
+
+ #include "skibidi_avx.h"
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <time.h>
+ 
+ /** @brief Lines per batch call (what the Java side asks for) */
+ #define TRAIN_BATCH_LINES   1024
+ 
+ /** @brief Single calls per round and workload */
+ #define TRAIN_SINGLE_CALLS  4096
+ 
+ /**
+  * @brief Monotonic nanoseconds (the toilet's stopwatch)
+  */
+ static double train_now_ns(void) {
+     struct timespec ts;
+     clock_gettime(CLOCK_MONOTONIC, &ts);
+     return ts.tv_sec * 1e9 + ts.tv_nsec;
+ }
+ 
+ /**
+  * @brief Complain if a batch produced nothing (an error code or no room for one line)
+  */
+ static int train_batch_ok(const char* workload, int made) {
+     if (made > 0) return 1;
+     fprintf(stderr, "the %s batch flushed nothing (%d)\n", workload, made);
+     return 0;
+ }
+ 
+ int main(int argc, char** argv) {
+     const long rounds = argc > 1 ? atol(argv[1]) : 2000;
+     if (rounds <= 0) {
+         fprintf(stderr, "usage: %s [rounds]\n", argv[0]);
+         return 1;
+     }
+ 
+     SkibidiContext* ctx = skibidi_alloc_context();
+     if (!ctx || skibidi_init(ctx, 0x5EED5B1B1D1ULL) != SKIBIDI_OK) {
+         fprintf(stderr, "the toilet refused to be born\n");
+         return 1;
+     }
+ 
+     /* A dialect with different word lengths exercises the generic chart paths */
+     SkibidiGrammarSpec spec;
+     skibidi_grammar_builtin_spec(&spec);
+     spec.head = "Gyatt";
+     spec.chant.word = "flush";
+     spec.chant.alternate = "blush";
+     SkibidiGrammar* grammar = NULL;
+     if (skibidi_grammar_compile(&spec, &grammar) != SKIBIDI_OK) {
+         fprintf(stderr, "the dialect did not compile\n");
+         return 1;
+     }
+ 
+     const size_t warehouse_size = TRAIN_BATCH_LINES * skibidi_grammar_buffer_size(grammar);
+     char* warehouse = malloc(warehouse_size);
+     uint16_t* chars = malloc(warehouse_size * sizeof(uint16_t));
+     int* lengths = malloc(TRAIN_BATCH_LINES * sizeof(int));
+     if (!warehouse || !chars || !lengths) {
+         fprintf(stderr, "the heap's bathroom is full\n");
+         return 1;
+     }
+ 
+     enum { SINGLE, VARIANT, BATCH, GRAMMAR, UTF16, WORKLOADS };
+     static const char* const names[WORKLOADS] = { "single", "variant", "batch", "grammar", "utf16" };
+     double spent[WORKLOADS] = { 0 };
+     double lines[WORKLOADS] = { 0 };
+     uint64_t checksum = 0;
+     char scroll[SKIBIDI_MIN_BUFFER_SIZE];
+ 
+     for (long round = 0; round < rounds; round++) {
+         double t = train_now_ns();
+         for (int i = 0; i < TRAIN_SINGLE_CALLS; i++) {
+             checksum += (uint64_t)skibidi_generate(ctx, scroll, sizeof(scroll));
+         }
+         spent[SINGLE] += train_now_ns() - t;
+         lines[SINGLE] += TRAIN_SINGLE_CALLS;
+ 
+         t = train_now_ns();
+         for (int i = 0; i < TRAIN_SINGLE_CALLS; i++) {
+             checksum += (uint64_t)skibidi_generate_variant(ctx, scroll, sizeof(scroll));
+         }
+         spent[VARIANT] += train_now_ns() - t;
+         lines[VARIANT] += TRAIN_SINGLE_CALLS;
+ 
+         t = train_now_ns();
+         int made = skibidi_generate_batch(ctx, warehouse, warehouse_size, TRAIN_BATCH_LINES, lengths);
+         spent[BATCH] += train_now_ns() - t;
+         if (!train_batch_ok(names[BATCH], made)) return 1;
+         lines[BATCH] += made;
+         checksum += (uint64_t)lengths[made - 1];
+ 
+         t = train_now_ns();
+         made = skibidi_generate_batch_grammar(ctx, grammar, warehouse, warehouse_size, TRAIN_BATCH_LINES, lengths);
+         spent[GRAMMAR] += train_now_ns() - t;
+         if (!train_batch_ok(names[GRAMMAR], made)) return 1;
+         lines[GRAMMAR] += made;
+         checksum += (uint64_t)lengths[made - 1];
+ 
+         t = train_now_ns();
+         made = skibidi_generate_batch_utf16(ctx, NULL, chars, warehouse_size, TRAIN_BATCH_LINES, lengths);
+         spent[UTF16] += train_now_ns() - t;
+         if (!train_batch_ok(names[UTF16], made)) return 1;
+         lines[UTF16] += made;
+         checksum += (uint64_t)lengths[made - 1];
+     }
+ 
+     double total_ns = 0;
+     double total_lines = 0;
+     for (int w = 0; w < WORKLOADS; w++) {
+         printf("%-8s %8.3f ns/line\n", names[w], spent[w] / lines[w]);
+         total_ns += spent[w];
+         total_lines += lines[w];
+     }
+     printf("%-8s %8.3f ns/line\n", "total", total_ns / total_lines);
+     fprintf(stderr, "checksum %llu\n", (unsigned long long)checksum);
+ 
+     free(lengths);
+     free(chars);
+     free(warehouse);
+     skibidi_grammar_free(grammar);
+     skibidi_free_context(ctx);
+     return 0;
+ }